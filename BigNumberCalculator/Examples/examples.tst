@@ -534,4 +534,154 @@ var y 0.000000000000000000000000000000000000000000000000000000000000000000000000
 0
 
 4
-4
\ No newline at end of file
+4
+
+-10 / 2385794759386458947634546008645835296485345
+-1
+
+-10 % 2385794759386458947634546008645835296485345
+2385794759386458947634546008645835296485335
+
+30620116590233497766558037858824471004362489349227697737736105343650956353878424796917 / -29758952452004269752865823576846582
+-1028937985623591010657298347592843569723457247567439
+
+30620116590233497766558037858824471004362489349227697737736105343650956353878424796917 % -29758952452004269752865823576846582
+-29758952452004269752865823576846581
+
+-99999999999999999999 * -99999999999999999999
+9999999999999999999800000000000000000001
+
+18446744073709551616 * 18446744073709551616
+340282366920938463463374607431768211456
+
+1 << 64
+18446744073709551616
+
+3 << 100 + 1
+7605903601369376408980219232256
+
+340282366920938463463374607431768211457 >> 64
+18446744073709551616
+
+-7 >> 1
+-4
+
+-18446744073709551616 >> 64
+-1
+
+-18446744073709551617 >> 64
+-2
+
+-906011654198060728823115449005721308570104079371581729896457838675748082008647503591404106221412659488640203860193379336086114497741099555709735946730196920860519788766501142670140714246056760517903639528152584515819019793248902750394318912591342538122160784697459821353154682270412104356968256301378449831264633209599625223342629286300600504125619441071098321619902989129479979620897294184542564341294018320893315231908283330101209028506254412313669596300986854346300574976403587830855593747420687817981393263798222313001872630481597580206304724533800847049002124996281749248129191014065705152228042862895791694042787058283938505552286487546873480538891952524808567971930045834852793656004527017261516545216668518767487258475896561856905750190744229244353072839764486714889390224536028095937782220484129050294727107777256013538465046876746008561854729782350466985298377924067233330798529415255444731549013412292036761562156468663314733015292596116967447917823253115170150179250985469838916387142175835253822611792500312546690122774870537323012873798816131304402014923235244549829825091073884600256439788626622558577892620686245075443399090227622025604321385898756669085539927340425573750451663347713575426334199350043763352286421371 & -44024007717863520321952470111311541530252787848791669450887801825379404030165597530087934803585941916860927971949176941236998376105326788562283558601112383108994585325642993494733110643917914493450012347345995010104924306886376501182967548634827260791378297305008818574354177304228073995109654626834603138966436074064725986788444258286315619357270355161915497386040656343174552721972838489277037143691722682608220235688469995897931380443994174067136602760257599656208319855449338393819515429643637267150696703429138870175397937937997611043942459674466506438788579051223053907603398827199517208120983737955280812406586311606217251832624664905116176487018338929090898948801785268100642633197684736691126658202176680154934662714778468217359114098054062722102920605365841239260843956630814861539805737157675921715110339385843518955670249042754371799696251716760242763247837412469378102347635272636229578723
+-906011654198060728823115449005721308570104079371581729896457838675748082008647503591404106221412659488640203860193379336086114497741099555709735946730196920860519788766501142670140714246056760517903639528152584515819019793248902750394318912591342538122160784697459821353154682270412104356968256301378449831264633209599625223342629286452298027249862171312290628142668044647057742954275272649897927612929314641419335282717254748414126430996927840749538850385685953327182038507666880481796442657814107440490526734533954143674493549674137530093758212751509972762517092633869789543970062538669395805605842156885309660458674725327065867723872754947032431367574468932871574192645457865340419532496719603778411386352454554025928951153868201225763152992963831772107250829139629713567386197509810796308919736242698694263921940939612078485656750198580052129425616956637795041895876460015526120919952313298835814342801852840553068134383990030532782251968761738486628288870264923681095092794104247233923452058122218326302562413676302060475221864810020401882685775074177762052920020033435081882915768037455532191844946960295996810576716849999718238394147334753982544951292626818887689961437903958692787723939220919471012786289495158972018825588731
+
+49034810742382258569792482402456175590934224028951222859765529209108843561010675788272068018894347624508576344188132952102360159359377671254170519973145502626951005480436714098534178853219527765172742623146237150079387484713148862596885479002968512086079046659615804755737535794827699293591385363378849110666351756818054377183350348318045858344167601595306381457248012696405992122943523732293230475191743945486661626139243828841393984283717794704320699408715059932465452685994473206325170845955728878825530742130278251749786765532567614868732453188764268360711835935697104718777013746234489652864095378747040122216789940834022957815005699320590009191939471624102158662444402295860459403142735097544904234514040815203177523725663116792361247154250114965270289771317323292200285433721427525155860699459391509731991498656711188864952021291596954385847191966336723709749498885012492086629259875690138660616778926731164738067665114922950505145701870556056353507438732077348561788151091255791169549547573852006505225026446609860037434591864376070366229600223720083107441430296523641803423233793953004096817138608166946675430648810936980391130741865335703871581800059297991336020967981940613074108173591988569417477608508068397046197017488 | -461316941652528258457596206193131853806891098985982513588738174979135541413735857693519830384811536393523907274002034935944441425460954842547466203525219718176511101106500495511823766767797998648218520706830592842886762087524334240944945786412730970717677542894619384912036844589431089016599324727926730274830284773105293460079859761858800483180299523189601805453165937462410456212135999633838714019699828983196604889236510015649299132676886875188689204555091023845246480469288460957704863474046437872661751017027312453724839873404027556173765109466891922014913141881515108235628360439621217834902592798426018559358548002320585586342429349206981353345561730833009968375530764980804872774676134720829550220511320764182447317494928452933409003186494874607614558244434879421389277921505260208049028084941634559057467500377416676258101399351857271518096941469266675559875645839445667534997314056765542070864
+-403792747127680655666253450688846737187955105990340855383913103927728974883483263942373382467253405785389162508873201092134815203021581607734417013415012909567735376827765905621032921202044979370429128559067185553045896198233089002496480754274717296856381950030297954429093689556999268854197073534258374843107666483937896744337014080491337199883818221782797120906680470673336910731336677603193689137659010024246375828304921072364750351934180009678051712181163566217103870738889424200177858360078811444737137000187415316071050477058958562084285311198288438775018768611978510812740228737321780601333796351532485442200827219241480810472495387290064432765806815652360144749834826893196509089091364120055222639085850194082165745327564223653922088112450385866478937986558970667862391330560026414629900532029759039849478044855901069183613059084055690612984044732663658636836354028779145391730541039985877131344
+
+571035364670515198498986167752170971457481572255907027941192960434582903559836558454624847457920881667976771418748961971462043814600370523121648441260265686546743470453211054268264910002034980525029914357170115469182747185785278846229294637235998235138345451376792956596523137504693912811164699822862733267332148675688248674461782410720618629767909251173846867338184766423900651314457506013994183202446175162967920438679787177428345002094256390540176434391084900665380452685398226101069187792922348611729539247575856656386663797237155456549972015540479744624006419689418482429491795123014872939073918857637643751264884945178446165442164537670175238975693001237061355418452847027708922438329976008799694517857653974103169409966537922141284882293392945424117532705891639713698321003764071422741088796606052630464289584366991512915334375449071343582437139772150238709195104161504934361419252097839985497507023109930945373354325449573563525177261527618970224402478632534954023062816644953461937423294019367687689367580364585676494805507911152246866851508483113396707728807573414360482396595819384345881135926171664989932706635701859397938814754737512693954384311992767464596946443339599580240195064421711613441677647559760841315277162036 ^ -227865004893768637621364047006429330861488332514931212766756281769805506608851666917881541147331776913356875821444064364146945866333065120847779622611946981204362852033112054996608219694858229346182097189245979793874964903073880029813356274087964164389960859207629782575779258362159551762408118833309347834383365965544031078910464375636549680421852353392536985909346118376861947150888405924666368060600442821112647664139028752750035621822498655978423614752219864257327086372914771164859366354700331591050158507712401872665269697172419019272158490902387975401097358880263166153471694134710081648936678396324892668072178566990392729983582231375027390489401067930622470148711288015547954877119239217721185404212379311089930850042411136886741915958992608461766165592526025592741557650891261696753393588884768168556447300133309790114676511444921872259564697794567876868025199758212471280921506149702679963953
+-571035364670515198498986167752170971457481572255907027941192960434582903559836558454624847457920881667976771418748961971462043814600370523121648441260265686546743470453211054268264910002034980525029914357170115469182747185785278846229294637235998235138345451376792956596523137504693912811164699822862733267332148675688248674461782560193691786947315944494821149633348457960970618046964346064365091743214705409959852849224573740592339386536355706252312582671864399130709055469724847386754696912979887498970862226440280082881918154876322126414182821583759453945158607046617655795867988916557142843296320989438770693976971232693872733837137434884257250681633271493667848888483466294035961565978325813599006205797142859132031029204805118924630263582200702421138760897944386837946311757421287600857855908760154465749646835554112703210945431311564216525717602996429126623991166377828289109625494552520201584561786008230659878030889819751014582218095370947653493514379291099059481078283719608802144527917036358583097652855870909575229140401249584322162310950806755784371029794730097081579959787404482442378166672172784227089168233264103736023987227166324992110254619301337921896329071460115308918877806145300615074455406087560584592368463621
+
+~1055671590432547034926898912277717907651203364716282984181943 & 340282366920938463463374607431768211455
+4995027483401023015171086054970183496
+
+1006402509995806105538395708789 ** 1237 % 1000000007
+358402300
+
+-2 ** 127 + 1
+-170141183460469231731687303715884105727
+
+3 ** 2 ** 3
+6561
+
+12.5 ** 4
+24414.0625
+
+powmod(12280147790477866979157020254572176507151176788398750381946439928992061895036794009082557653824051864443668484616876293093630703953557638803482670551581676212890172978884699764963328635566043215445110298330185225673561266098625929118830241526225902742501522219469069759533511737502896178905068005188356803319928315720460611429441481745980035476879562719917583456608941733176226180569394269371899117177231584144489125839731432521520091686678583919874700850389168792566464873072112526217767791357748074065555572338330250468347120790651772772991547356093171297836373363469559368436656903826712923299816002508337281479127493506057994201810740429664081, 9770438617560480482257697002858645657371727094513347722635622899153631984873271211147471229701597255870511938953045322735254468123842049894527527236928834943728891305516836452758607323349977174986962833116148913916050744782543746447398668549654359086782514597956016507549867781228025536859160602304848878560038623662056930182860472850767144563230571065201812272439186285044328027168318696673903680579331461562412225180693642027461344270435608281856626394617791962716060724039794031799215594286078940615678040911156099122231936663877774176672218559517686439390596361262989761486062814840023463777944110862715866929311, 25106719236968361281894500148031193790010692723530849848214344661023776631249820561793741924821553528409519005834498821742227817651432714211169470017213563365061375212450331319009233925922438205389666015365356058926149684538294776503300477407298863638431455219573352656445399980345742826927228704423250873125368726787888290573104565949605544703000542904064625537915796373367512681674069489809348769751633093230223190786464347439221781530911262382848128056891334905539907968968700306525476471157361199205762704354630859887385152084707455099060699426995075556608005636266489173825613414080515400179490458080869212625917)
+3548671187860685097356223135659654729275218690603487721397429158978862777843821686947232447233699839798892154751163670344823079114936918622780827781650965817493106487966868371944688372808743440667267552454720269529096570704605983166738909032993015930864935482302029403856837870839046202443742848798438235252640182174198393733303368001085086033522032417386302628097108119526192444525002420291917149400721579755108690224915491373301095064034559550805298114719109615471033440207211169633223207145664811613681584759219176494480280672123854411625073067495930391320096524466203889124687578333138350632812462069912006586087
+
+powmod(554011718612942692681900638712781843154167209059096804094490395521852400514354942846966902483380415276569297288919968395846783684771363948433455816404238285028219390080388660707960111344408435737181547082280971769784463448383410273190934807930217932167191530504919200633804802411822909664909387693876355699079310863121705063842285586434701988826621960314332545261955188298894576545996202296227906587796215493900636238999144520128952530444313530063954656821801113842812395969982997373708103642937895012400502028873365203885394120911553236845122530018714358178013039951390174876242849099017313539294079715014666005480984879355668849007014454436102473809076884195861737698835464568826670812003697606410825022805864273345744682571834875404953063780756127971785540273212264038449922191594085699593478089099413397886392899593913244229667128684897077828677961767321461731891427566958526392836622749254546448749464781491389316481064951690342431430742200546681380093121856398321904371652080982041279877081440322136037338733486389823055358314649248588069846812019926382191643391079729527310596813673369496139719405721029866043383161472771829171862976228891406493506351426698970120637736345421922649998932994622419788647584268490518950970527887111163327565623609488568044870, 117760842359685140809523771977383545794138625137529167928353802779722796758082622573797483881007454970629852564630148012050229273547614685224504133141667977395998281577983791557399401996124501067752532070319454718190438342554003054793726517834404171919470282179665847313756612755496120521462559767844078232874645251720291318564799471905027422263609057253605195244640689029335933258185468597855200218342572731323955816816582149701182200782992792665483349131127659836985707704418331745536200066337984485179621037589313528119062301841934420562693366465819212282856181662266619801266748187917344487897417248636957989898463144831301330722065283190348442496038640224966800338937325220516835092207782415736233476988746048839495235183680792419233759214442668769176085157963435158329823951812140160107321386656123359332589985916057613875377970828679494308040775140112829936606262461577352337319340528414104218523396403164980106292351922545124120190959389228739124034713257778999432209677066775691149514022724527010545889738262451365494083527832427074912346486209063047051311524140789135530874291192719413186220415246471793009080572224356236795681608524296136688336965945731213470370445088606312216494017089237107542765026612416226254981591748, 552027769377910851704516734064085175395614173461874557072905331554568531681500828482961541205034857637345843519257074692922644452953678617234137996261693504424788891681310070766620378340455818509402838603597538218555800226443558543789122322527559955062484231327062114354803707964679408209928863744677983019355828900078243924579702643865203042135622838842125770321589882412232313014577203907827137754977846310486106316027165395055136956889919161325605928143172361685863300137857473531788850653286822893112185301799898996854794906333661341345881681554186104686316006356339240890881391930077030484720457495938482553107073783256701209045504686684091728188075402906813779544810892823227504098561391587696079097462877368583501701605818362632178139716511383988702364582597866774353605699263654312806556637786431108249271341199279106217326953987378539123203620799500159208446426776052486980334316184689159681954826173178793211565140570346819330090633237678004786567161545761097331547191233930840887113062636820991256337785188774155998748960993451530259819701588110668984396118077405135009364865101494027105405105771058023033871349022790212221508172375658876801764454898289348765466132481778635976509705218530073557435376654060656218430485257)
+167540815442388567258576237714801199870033363953516473395329998360522114813800760864577012660961987072439714848278548759988259071049808469600138517456227088908185432532869888526555550815726117214388595590261396103192180057763035283130508908686026851186479314314584713243818355687037158195922218416961529104952639461412190372795338056157282352019495957568341774832213238289815536160985765205690586865045808464851165010613459825883333356489342467839373026793182751867778504407330203570864694012020237695789066556270277934755378982641792414204444297255315217802300102813870057671168434031104347034386529189369545100024954919715179520560139242565594892558563489195478976029110958894328875770279388158545298487168427703585284479222257286067822759011618040235383541261215145548967997803565241630300971381267066414917856808596277910770731799832413006079652282532788286408205629091758859841053860292511389580251679225403077556318951537242958619806378941578037189471975057966114834332538005975306879303282009776485587823403199660137474170521716209551006766203232413333479664417211856146249499340736264523833172538581181380025599884281248912556189134312014325583794682445650887107625686526662294956060519864580294407827792142109918686897122581
+
+powmod(214935979616179640506013615738592540523161341722858830838397964604972409343337810805971419158752571472744179959244442573104010543162800086680891566285078281533745390579044343462146752400431474045973699617562255614958037962964694212530512415259680593398062277801286552049918115254813573828959435106222662769053786440193446691572945961070902, 142595501676133428639566065868885261818492444989780516137701240838234718507115425791785128430326715353574497209664189491391828679064561871966481089813284361314639105354115551580838308412564825031253212130008924264486544403713750827288532335530037277073125045414250405292880788596389054887664950286812098030596, 175317007117261944493007098678022345530965735031185775906799997850257491484093904599604501804868590637604554745658972496758258904187457927773878086620439520348847751235445946142979072304014767700589730748140476723043986289644862211905844050780034382623278230638191415645803975359308620818550882728711325592212)
+149736679687252322133142440886427604879326408466966669588072259102194137165014712383166754999642493761364768912165148354711061111795397899127561390216459976372305569560928555324017002501962953684349840865527157805446237758324970110985365126862642298184422483151236010582705761981053111242452434571085033126116
+
+gcd(232896531029273931619629595068735080805069390276313426727294022213570474964086560235566168280026280278074814860375092270564164527001128634719459490761746391231902208148691069862038162881925453919499281786044333665589157933719498969355125116779338302965098457057864019327127948724705787439092274454060788218345173382742035633334832061669232961436051123692530869020386397128905357475872580544706685260677122014335906031192002722904985224795045514128931694493167421906745789617526024643910745562972759620488563474851774112506232176289617354026863930037789009905512576811194322952623503242497533941215378164914409830260952502045370238512976438870265465270533722777799590736249919340616018679084383637927316384157792936403432599232404771528876617605351180901282618434439244829342176024843980595792267527520590830948758690112162964202004767176842525699374899830118197132072769972847962261337598610082382283575198837794434383882656984232046517838006531685065104110358588170085218458473506203844771400882183005045950304765028603652385362049401108116208657829051487788576483629534434161344756869768889325297404398993788492529629399800827110474459543020040276358040428300108446299261253273370338751009700378422081864159672661458688766715549479237108564180200319518321525452570083047324865778716732673009399968505576812612686619556772114745719056256767239012599448590436007720540698554056861770848087858025814820736201510224370776536422562161642110993915961071779330892626231830446561236081640559564633665339408081956666095562529173960509628322560710008824761502485710528615801606205586063244920546311815701304921974588107925142226025355712534920952796541865709244238430257394352750118266102071541169994694171583976254975397003959269924092332632278852756465297042427930588957744533326835, 341988239190078963369889802186338993438217030929517988434999852918660012314550879165904686040942623120959748599314949907153845799398709663637396327103606231162742232504845460884625241856705797348984573725395179852884157897853016214305557220034992990386664229886214431747030086527606270499280437214403443639286120535717519147685770940015289823982960351307575705311757634759832791997826793852818194238356649976030961284048818800893588195141069370413218546341467103435572702010425887193792475777024524435382812577075955932735034167086745714272831965742605666878048086743399237610680232823435981354263022843324426336046933045302144709350264731917973754252033093343588128098314226326976323719990521900082403443554678159443106899586426826409228139078422956529796596099647069547530908666249361654094999959236295002323822234468078672666985574977915511756382252356939757997477338616952897617268937486079412928183415540326432621410658491624541077602684195221154947902266558664552977727619117485538303936224072105555989606840544753291159149087395579959593123061744061868084910079611767862221181842934030823192584766100217843218301320650966693084587312560059023282322609440640444567238399720228914821336440492994413705555763400283901613723733260843726494935357889897156468598716723944929179439744624755773191295198503759948893459076678031258206883948650745581833236403564003851297582780905174033013587783001494545212962027010762308144718126212540859879340796245939096363794703730466092745902759964874900031036462548724873922856618365128820152400220649698281133745414035983497410659334873417452369775100280754432620709306744138214390432829704751019291431197830875881634517885156107106221565001374515213810493480497449432437598340)
+6351252870043504372748007699853401786911570171365238558936491407976497037723173634224290982083989024270694267228391572865193692717698848446796437896942761356766612182384072121966301823825166651829130117675060716555266538274418866290326020487706914157585986231572999487915
+
+lcm(1966325735160270012882399682731545440663288304877830948345287656635437060088027740979956926636872226631010028948299822419121990345544099846940201668560098354284096776519864329774465804144852179881925584071825138, -1075646546998026563061886036766295849572361687927503669576153441415333803516015756717240900612149696838617957892371331737078570497447314807995165178176111535516161182872600275927754116844742354772)
+1057535743649250255553234682385655981293983594941014987579757655104671388605800983446874555356030722045233416941871946402824150324473990662477266849764256407951251665062434631456923923899075091146602844385255938048977733382175720890019490393550632735240818785411808341664363233387778501886237234587624436021678363960601065821045761271919647255647644822848777939462231743372597007183952111136515526971929268
+
+modinv(5691010575392220019563796906934953629537787865294523458484209564233967750312781734861109712288707551895449342949691636580618628906596593630275587353113395362977680347882736842059802130773593226954820322779079065635748645640117355571199099808524708894719120670394226264065935063151302342739241769188125487900519534671324056853230271681072444257988232114510954425333979654981072087317967276295310567906691983388930719621880426375309445383696252193137819455325064011081975428149528185657132712379605517861764322698686698283585684438010199336155843491291414354755754572902006142548095643029311623449239757779127815209240138730906990057607213954300160883384608614480260695645525712731556726936918001123861391953431135723407856149561328624851327631651776487855830102467734182652773616005526158266401361537566226581303109954719083354202921291731651678520023677767441365255540874959159031221662300810750914621476538514408359860779970539053265564049484296657731940419503749902646793937256909029329569859823657567100882733822278007709892928398873445118220322327618953022017828742429297828900203831153990528998328686435820368974736089076136933516313393268664891700231939221306940989321751854013651999675457005570622, 448300822312054091267016850670793519262298819085750421123477224447211101880027733936477713235056159572784812832659772056567644363925729440874650704843592357331321102898076567888440207339258438359453532097550620123694613591968611610040258695447620245018669991328628614049017511305659593419976981479477679296990769825176801783557643393277368701086048543728150581978486014224975100248341032236072462520771214438692987609039781185893901612982332918361876544938713821221176268653622576374390251974457467469709106057081325760859366893564837503513451303280915761133492434209670884087670677233505306744746298025387391884480987363597731276025036781477712371110091453736416486234328265908793716129762279428984625346863314176056559330316778607321605201670329779194835196674250358421219002540105678195019452996746233490405653189944589481353673135075805739167476259775196343528840789278347524408051772123015817467425803598553225777973090078299837867401399776435851124703844291703029988496606791495587652387023026443076215114181091937868989335891595943757981890632002492376752326869854906119237024809012381347835451092398936134242293607531361128654071023425758597568362124784366582115122799138932284928982002288160083115323792634855758811696004105)
+343433877541583727065241448474585189744505870544192563380144132995997207920165427531645889014046593189254460323543525877095857374892238653972198860184338198499139855117749291456383854246956923810287396878638281735440090587265616060003848747473508246082249126907752214865400294983514390658186735400366542035026567845067352651853846445813802616401023849617648123993236612636999542913275726284282210950762699445986624649470517965054377614014307784181643983241198518907642392980368065018742129278197850756600056200870001484441179579692115553828526556965564562382215218691618371226830567241917358419625425119682631548798184496114729468228164054260691851418641237759241636399110322409286643521898173403859107823960761736753659340888127411677568459124136123500610107836700181342988220743414377530606893089360801181591435662252108699552728830218006363919476141224074616162786539210831563289971659022307895428179190545853037987539374261162629009964101989308814499623459703961776640315066666429751486821519425245134573231326031438442545060505594328355226638407768873061724296958229003934556328994859770212476303961840055730178682231549824082006742956116743553739102064329066585947291868778385100119047094733359303662066176137204987869711921223
+
+isqrt(341428803369345451123421762326104427889242993202591263624817879028197268561111340870377739088439903733088139135133164037455635106156148713913382057261578536003602969692533282809269181169299032384888081581227618943289589140793822524255839557277701996947705214277329413563613008906602980077284419792419879649411329439062784253544921931078993560762044807525932371395339441264634834408294135153659786784101297661965629144397670556123769114817149054597154772713136180808914022431961946073011655629857682400942299019567450562789762024174869586592517422821330238199086919592082056617126078961367032394370634667729355587600844823300391009931660125745977377170836910612945558182316708376091965119960736760536071594162934540411281257792294987854961294749470971060152115500590957303089186273013158900156933573845474463795887179391931706088436506267166770345249483675349830745806495862125364129959585051175133879819557088805255399254691707426585558135100051137024282352956997900093387263733936603213989006420035721580154285468705841879207477770638424925959106352197629552070110055384803932017034338033666941562585606503282611697281347394261895391200887197015440950746801254280006556863293425325121984961376723753534793187032876386348324196280101704608943061544027021318912189094971610913723228941174751115183959954930004633206717113873257973941145070648727062780553663307231540914198015359871202375303486719327474020011256981889763901541843780615724827479136376865207117436744262166292652407674600020662026354194264032349999750431807899434433734405004922222770298914276818888813077267784512438806899282543510457739401605590744650106919848618469917731952513874904801765287538165450716760035926312628317805600150265690828512557252938032306243270203347542450475982506876964102651479496049421434978308444740891902400440864027614023196265237810970307797459919382840252287437135772120196655536753822019861760458625420176264776795046909631231363278950391775553796437187088541088191202031499717150760525607903531583497190773905725202309396862719577112019564741362770698763779545322626782409152296379085616009756958107962717307723271146785479257189306281298078702544081039399462070081958546698825187187420058227380240003436423956976693187569694138700199110564937808301732995955609098945558458515558070369176518089109034868939775145608817073355320221290715967595451585881951777233515285466301698861297211571024999311365873334884092867606224775020923939399659397532605083847892896206621271174648278007661233847960048891358161622890637730378218688378685890064952271361724312568147662299445056716188179006081611621889310674709428154739716996562000736856290402240212679934904423540583707449931892663373585597635092051880544600208740756606542666181301769873660224320035721899263275940694042679490482384078693281329430311975605090536019704333586073934120671723311326819643606979797120610503669081756778004464604262042471081555810993148794050841820032868671851257062610334540195287556169190999861180222983263998690995494535899448208470476663271049152613720065645460334206177041986189870263169352629392743306964230329687857151900944385907720083391444978778079886386647096475270558055919127046124908488007063395388006485010950197070659971357721860859915381313882861746820321873334972215525752516523372380859549504624130272610449854054658807162023576200264507828755073114560421263810732760068181731684005526538419536658451742762536068111459982009279169557227213011489412203622894288260084369145719062581483820399862189153807536025618615157582873437204355691009812043537502324433592363339910867190825826580702435774816099824179459067175816827736830713408759012556800170078022475678118152322752656160559239743399743252460608938582926399168519576281966725146864440129071923939275495659964764543572924689812634196643496599605421256958535888324907948871314687677637596736352017429738446608956994135556154958835650031416321375367710152726074776949839969646840461742792823928309682336351494026124960968570665909596629205705649450904641273974758293171690715853347686918672853413079112372323560980259248719300325447308519253152931618258861474086611090984335738328825579258790235527119825474801460650195037177606398025783601401488979201484657942463080521914586744323752656828390590973778131187648165705507745442358308013891077529398060923434470134406913338762835907020066247065452884392576920888235093709563996007807815335613414578694803462537336105449160735860689971733276899557200326437645825953320127188530739776009317629301366850290619645932562061605033086781634568736213602277057131999511954291195916845981173901517457614947690302376577977455401006331665997340223093028519324993218934117838010705150944344464164386804757672210450611250635724928818744725340313881099809631101226275203959604311279635044257868240667221247134617480237339026190344737629422455939064525029245827699864787660560850844081949130326880086011557187005064213648240755757406948497707425274823636761113630945830212936469405659157908673495291658396496145898134877277253280594399877743779929581992756300019491292457459107867317886147008366436267088282177026574754349917500533319147262530058842836753665245502869450163243613059063835225010116691296623838159968864125988606244007122319127276377337192603794615002527133329896263744934125569613083874633068027517281331405166574753704125242696637437405127836992979752197682128552363152203688397502447175030796958987434889269719897859879488864166422380531920778572416773116597479174262297321952458787347113797502465031109097625001185198612746023869161846986206921508514263051563362067818262479031249042435395915297796892812081876938653530417002465093448930703857383789995979325610320399934964065059738481659570890212378766027258697554810582148057647722349145083232569377991266674872128893464523395849266100692528836781950016420157757053075816821045526404341664229059504384790557984673031065256329414322756458085146979803248906497493142648284425095572454918070517660912443497937420701649505369451659998110932316536064118517943895829232416045710529)
+18477792167067618880324891739895497111692117586108230754061165674440168359032049093688696366956481983462487904972900915358468057294329109729678744244729027904741376250525512880645942961420668865134225161512832927372632747843169633932590881022291994289968685723664350730946564065430763408106996338323528353644062668255668558036255422930566691088020035569671875257995093323755273773065991277339551261334950215702472578346366030241624934688981167927989638541604670105816593323721968519573737895432269800870183509292659239994859973496307021924689810483618281701185893999211251794829988255362714338480576269408196785343308187893125048911142850616763484074895174882364117529950090011788393187556802355091820714653292766548985170148814892484822444489961839930555043835929501988061427553095530968133701879930295534563469359690718582636777418162249560226960090549171780839949185530121474030047012712850745506885956364938623911835869874565146446619774732090693797411930400391657720415829304702469774400454715158677382881300985372525717417328039154655928432825408360424925397882314938290010773521748780204126345498601060160965147596837371908670740207342544909647050538517626912392808784025006329500927689856876980232843659269476325254671570009051238726468499271263970155587482118053605324527724160003957158821721363528406066110218722026517166350052416010945704348789891642544481958307820778677911026136694318567579444182636258342221296801765637421608881112700367714733847020362656095374908658236789746346554037909704583342869992744882945750842282996122630849841935844636805789964644729446851644442397527080270884134858092661815193368127970773982903768784198963407942938802251346157906713995451059254374403267457057869559347905961347918625332783662004079121899917076440554421775049009468271656297342479695988948786882879777107646865739872847323649291262234968751860599342307700039481771897177628162222286726845847219867171038491879770899368906012981311558959787957513727669383590141977169956926873240160177403017421055953269231551217793407216521674095936730012082659423086699125796823907857006239196907440910424358418544037951030353759743430018008329702765417869649103580041279424349985399105960752281649736157457903850093451380924514155423800008935409012216969392819567727106066713827397616977875409288648875485378419155516044485443834637510973792682988210831953754505332907800032909896586832607374116342635752859287709698722153987869631600177239314716972542956565775931608127521394469091046515747621865004971232165797860635497841607455314893064847970682037314048037575187961949291342542855526821413018973350451276838395431761019939555545191453340890961896846386981786658041294562636900741797780006399039343228051577849448443018111970033824652676655592250335545091161879313169265620105009631915057737073405984886252125274931754602645029654578107094683572521477418487792202206412113914805355678923352581592204053215576678076935607866863574093487508822868614192441890709784338782750341146760023956028006962207150789500079276
+
+iroot(129158473212064746580755491816427557563427306162447978636778248816525595456049677643848223583338480950052708356285308750182887459353830866880445689716615663440258212880011568339529844778058777084729622319874152245021845223011741841227719256649697676337372461685577793671230094148909330761506115039004469839522649809944978037123806497284215179540397209477265420505512554751927337575591364710259832345475961456622403242968503141717602096234859686367427636206242774117188760789344139090964098589628528079824018719729850819693993775135452364290188302640660149010330622285328370190740150432208536453764197361614033063875851228084309252944915524067174913493684506727188106288222446542625159426519095929000923565516951736834378287546396022259140529502376034036493570451097004171980073719975490950873925685392029949748915924162415049744088290236434805068719979500490539953603809134214277983856964754884946774291010108593106031738606669319476680839068303013666096325500085764590671691582031331958774483016690143618119460213427612541644009713900853787050191818685068503930835929577258629827166882592725520734078277506652283205906784746264055524864570922078838822971190343718359842478004004102286451361169562345680190194081253755675642214804054192051509372421398605755274998905179652813144202669999970591252097065934876338590752987749077725546159329438238038629530499694684473463020754798993279493027504100966819711725948750437330911671752287098568230145247938692298066822599704478823400830491311482178150670900229335683543554910969186014558238748987002364756578799626574896455901784026889832068224615428889236576628930862019790499102846644969884309315496336207631388958588316077472710634917060018386662319146537884139496405070111870451360813255711886444193003186490809552539595646441845515467288387435433581309944488, 7)
+746478936195187658791320740234540318995864766105686748461801647331675651741097232055284075541391843597767701317597018857183450701806905003025619798041212534344770619030689610350792356060445959155315401457998958727975785492104672292535463370623503241449793553
+
+41531988181882983853060075661043450586197253585320015726787101295785446943595640362431063967004992181299426069696760956381722157190271686151665894076809612404237266756058709759446438978069303159559168369591815447149545844808823455033082792992240158272265784338501259797086970080112979450416286914204370105779801463594267876618814540122346326065221564793845939121655024322364987415041758651326866796044489366588900133263181696506279008922556442350391743251463583494183009215848078800400123600295813992554831886837746942799111659577355284903989689355299478085852250969477445909323804143859761885778918347**5 - iroot(41531988181882983853060075661043450586197253585320015726787101295785446943595640362431063967004992181299426069696760956381722157190271686151665894076809612404237266756058709759446438978069303159559168369591815447149545844808823455033082792992240158272265784338501259797086970080112979450416286914204370105779801463594267876618814540122346326065221564793845939121655024322364987415041758651326866796044489366588900133263181696506279008922556442350391743251463583494183009215848078800400123600295813992554831886837746942799111659577355284903989689355299478085852250969477445909323804143859761885778918347**5 - 1, 5)**5
+14876504274506379516530100443874017563397230903255430433990232467919106764818820084168915924543004209076689609337638742928524468316087097737722636090651702871593496121524331094862159105914514105104612915163948523424635578131571402581146696834732030598969922066396980270620521653941378853197298222179313822602757717712054493631811363556556054738698658601660132114776328648738722730108994043246233218698034435742842001870185617075040676111120844544317311138151052829180078627113635919683554463596546909780016555356721509121584092242655559070768826600376270934119040682604332020127482766737511186825870972669979781770570583925886579421757195818299472642292415944822650878715610207582685467990119812067749598117179722512112729755443615369676695114955957964921634800921806726751395217288893923511774929720491195348991861910724357812359153434699149788735599539575643588002349042631064323317796014269089983942004267359607549368688225449341275951872116872177443915527203732502430254345771699971661271206660887239543128960761745425806521912119505289532590521224877126000940446923348950832639598297249023589006112927674166790173061794497084853177317177337097651385818885305732933032849475756643503464715673603422180618775325301055227715750456084234633894516433048437955061167302809242743146211167851809790845233261918679821732275532097700120463681442230497266777554092614109398770124730268741574513298570957568866771781999251835020772459322511402033596636287102305221284504267014493478213659776657116089414246367251842710506821077831636133197564148650970053296456930996243384689746851049293684786343265507955335031178545180684353100181453771608538225124542548359914608943461874236415779743004011138684686546234751596251747148820616594878902653444821960292001054105785198144507255068758172855925636532684605260008120511507021760296007316290799348818508854260504375350594328134585131097987997765786289432968181338796005060554969877934853756135423066930016127391097537861231197033566440407840977303641862154512674893656772840617392915900344525306938223618102780721433876918697768745298517173384577393194723916262652709392795888061682306830738921919431541710072886674927422841916171986683111161954893944460425402940264180029301621344347043469321531259631493797154208912721570041756770244021963422479718148200499691451481945512013998093025522304216314237034560949410012336303966312633318545129147468018730401851288613769531
+
+fact(1000)
+402387260077093773543702433923003985719374864210714632543799910429938512398629020592044208486969404800479988610197196058631666872994808558901323829669944590997424504087073759918823627727188732519779505950995276120874975462497043601418278094646496291056393887437886487337119181045825783647849977012476632889835955735432513185323958463075557409114262417474349347553428646576611667797396668820291207379143853719588249808126867838374559731746136085379534524221586593201928090878297308431392844403281231558611036976801357304216168747609675871348312025478589320767169132448426236131412508780208000261683151027341827977704784635868170164365024153691398281264810213092761244896359928705114964975419909342221566832572080821333186116811553615836546984046708975602900950537616475847728421889679646244945160765353408198901385442487984959953319101723355556602139450399736280750137837615307127761926849034352625200015888535147331611702103968175921510907788019393178114194545257223865541461062892187960223838971476088506276862967146674697562911234082439208160153780889893964518263243671616762179168909779911903754031274622289988005195444414282012187361745992642956581746628302955570299024324153181617210465832036786906117260158783520751516284225540265170483304226143974286933061690897968482590125458327168226458066526769958652682272807075781391858178889652208164348344825993266043367660176999612831860788386150279465955131156552036093988180612138558600301435694527224206344631797460594682573103790084024432438465657245014402821885252470935190620929023136493273497565513958720559654228749774011413346962715422845862377387538230483865688976461927383814900140767310446640259899490222221765904339901886018566526485061799702356193897017860040811889729918311021171229845901641921068884387121855646124960798722908519296819372388642614839657382291123125024186649353143970137428531926649875337218940694281434118520158014123344828015051399694290153483077644569099073152433278288269864602789864321139083506217095002597389863554277196742822248757586765752344220207573630569498825087968928162753848863396909959826280956121450994871701244516461260379029309120889086942028510640182154399457156805941872748998094254742173582401063677404595741785160829230135358081840096996372524230560855903700624271243416909004153690105933983835777939410970027753472000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000
+
+fact(3000) / fact(2999)
+3000
+
+binom(5000, 2500)
+1593718685349438375691025792935919087257129434168729738511421888725183738249343168628721321987372082216725114025558627431929452538403647953823060045455657769129873122313919773933964584614308322449299176148648925847304800236435693244409410331220544318159889227102593634458107549089358656784053736247584401420310445473681941570500042422596205820826613570804985152082496060797280773893645848289449988113029002848965835841822271292556855461484325271065638860012861073778999218996871035158899198654278582371309677671306096769432314126537889059653739614763267148184153554042435532017355139763002046444189510653672101427075975090258426372731594098223421430173974301569687693275235007610580759241697870484100945163805766488340713897642197106542283174953794968649783206558992619899425465272314921564909489372873935457621535462289487338592584093718521896760237846849202260459597759609074699359963531119710383496975952571120686883790602219730843976469983385082049193547335825798706248498798896761744609761227753857586204130073377729991158520821418092217638362672853353538377982685094940324887720944387190008030334758815325466470631385207196227449676806821464461022872946644055882208785540986721560176252586558088366726782973824315529862858085233856576623336759865034479914679006514874611775506177114579705449884133344535068585516842987546616463555923859087650313307613765393769667190506797376737518707832888662700172790377793259351868797507163339600827270303879295319252652644612708041188699645673663207276383716320
+
+binom(123456789012345678901234567890, 7)
+86730990064855663267265778208217746458026211374577050354806321054794056335841738097331258717380434333220793441439173691522033631312989475076610700307480681819059756491031727076954016270538639963084560
+
+binom(-20, 5)
+-42504
+
+fib(10000)
+33644764876431783266621612005107543310302148460680063906564769974680081442166662368155595513633734025582065332680836159373734790483865268263040892463056431887354544369559827491606602099884183933864652731300088830269235673613135117579297437854413752130520504347701602264758318906527890855154366159582987279682987510631200575428783453215515103870818298969791613127856265033195487140214287532698187962046936097879900350962302291026368131493195275630227837628441540360584402572114334961180023091208287046088923962328835461505776583271252546093591128203925285393434620904245248929403901706233888991085841065183173360437470737908552631764325733993712871937587746897479926305837065742830161637408969178426378624212835258112820516370298089332099905707920064367426202389783111470054074998459250360633560933883831923386783056136435351892133279732908133732642652633989763922723407882928177953580570993691049175470808931841056146322338217465637321248226383092103297701648054726243842374862411453093812206564914032751086643394517512161526545361333111314042436854805106765843493523836959653428071768775328348234345557366719731392746273629108210679280784718035329131176778924659089938635459327894523777674406192240337638674004021330343297496902028328145933418826817683893072003634795623117103101291953169794607632737589253530772552375943788434504067715555779056450443016640119462580972216729758615026968443146952034614932291105970676243268515992834709891284706740862008587135016260312071903172086094081298321581077282076353186624611278245537208532365305775956430072517744315051539600905168603220349163222640885248852433158051534849622434848299380905070483482449327453732624567755879089187190803662058009594743150052402532709746995318770724376825907419939632265984147498193609285223945039707165443156421328157688908058783183404917434556270520223564846495196112460268313970975069382648706613264507665074611512677522748621598642530711298441182622661057163515069260029861704945425047491378115154139941550671256271197133252763631939606902895650288268608362241082050562430701794976171121233066073310059947366875
+
+lucas(10000)
+75231981350698779410846909982393216960476220648711870145930661707737084289078035666010507582244187056765580019275216475394984379018367214615308512822861907963818123866252298604572984963068032998653492787435709471086684503000060815704634212021029848632361813334383359731211074068222783504901961367052576576199215227894301383590817973977920943758603040855496816422652692142153650787401718391832078260672923427573458531837900860573718890061736595980497167294974295757868426785897046543463768645076448653098837550518132047266908696000688921418929069721000052098789462575393560820720985713503419640167853307208066931815813727515077448969711916416916819814046640169579729369763638062228317398264409756897457283556589623944107354528671139569457619351121859407768343388658425604738876740627067984235513453338695564465891569875356982603970196239704602497363524159509410282515641379776717045429837402919325161172437635878533108169501325443619115551165195355494526697215496213166589887299781666807464387957593663732929150823591995895349753862527818809689903391161471162861973977748612485461451938274960493921510534593089391203512573989203899386783893121182995342220740920906756445157916707542627333367583114399919254330738286099940201084924181466260977736187575606957393720409243389065864069155812252238809233364750630700777750135076714877359708612540909202663634634314922760573819343501978179118236688082697878306145109454691947479702283617959353220170352645937163572565746902580480964545570964990308528120613570816590176437391788115421926340428325530695874946624510645772316791139129095076219615025716155100162177919805900866224583987187385757943312996259516523878234097124863300547240283491039121403525888489795306895583373811084931277600007878540838749206968913101529445565801595610834969589831813129330510906516236672549600399156286414491364656139751118671734266631119825420019293679487257709938070421937964203667505930936805558809580438512171165847393676059071656816483767113881118363363143516669828270959637449098668720358751688196246914574335841533124018885073835988714533655280383362423828127
+
+fib(-999) - fib(999)
+0
+
+fib(4097) + fib(4095) - lucas(4096)
+0
+
+isprime(2 ** 1279 - 1)
+1
+
+isprime(2 ** 1277 - 1)
+0
+
+isprime(3317044064679887385961981)
+0
+
+nextprime(2 ** 256) - 2 ** 256
+297
+
+nextprime(10 ** 300) - 10 ** 300
+331
+
+1 / 7.0
+0.14285714285714285714285714285714285714285714285714
+
+10 ** 40 / 1.25
+8000000000000000000000000000000000000000
+
+(10 ** 30 + 0.5) / 0.25
+4000000000000000000000000000002
+
+123.456 % 0.1
+0.056
+
+-7.5 % 2
+0.5
+
+2 ** 200 / 3.0
+535646014752996758513987364113720867507400997927597611767125.33333333333333333333333333333333333333333333333333
+
+(1 + 0.000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000001) * 10 ** 2990 - 10 ** 2990
+0.0000000001
@@ -0,0 +1,75 @@
+/**
+* @file Benchmark.h
+* File with description of class Benchmark
+*/
+
+#pragma once
+
+#include "Limbs.h"
+
+#include <string>
+#include <vector>
+#include <functional>
+
+///
+/// \class Benchmark
+/// \brief Measures speed of big number algorithms and prints
+/// tables with timings, which are used for tuning of thresholds.
+///
+/// Only one object of this class can exist.
+///
+class Benchmark
+{
+	/// \var pref
+	/// Prefix, which is putted to begin of each benchmark's output.
+	std::string pref = "bench:~# ";
+
+	/// The standard benchmark constructor.
+	Benchmark() {}
+
+	/// Makes array of random limbs.
+	/// @param n count of limbs.
+	/// @return array with nonzero high limb.
+	std::vector<limb_t> randomLimbs(size_t n);
+
+	/// Measures average time of function call.
+	/// Repeats the call until enough time is spent.
+	/// @param func measured function.
+	/// @return microseconds per one call.
+	double measure(const std::function<void()>& func) const;
+
+	/// Compares kernels of limb arithmetic for all instruction sets,
+	/// which processor supports.
+	void benchKernels();
+
+	/// Compares multiplication algorithms for operands of equal length
+	/// and prints lengths, where the next algorithm becomes faster.
+	void benchMultiplication();
+
+	/// Compares multiplication with independent products on the thread pool
+	/// and in one thread, prints length, where parallel one becomes faster.
+	void benchParallel();
+
+	/// Compares squaring with multiplication of equal numbers.
+	void benchSquaring();
+
+	/// Compares division algorithms for dividend twice longer than divisor
+	/// and prints lengths, where the next algorithm becomes faster.
+	/// Barrett's reduction with cached reciprocal is compared with the best of them.
+	void benchDivision();
+
+	/// Compares factorial by prime factorization and product trees
+	/// with left-deep chain of multiplications by one limb.
+	void benchFactorial();
+
+public:
+	Benchmark(const Benchmark&) = delete;
+	Benchmark& operator=(const Benchmark&) = delete;
+
+	/// Create or get already existing instance of Benchmark
+	/// @return benchmark instance
+	static Benchmark& getInstance();
+
+	/// Start all benchmarks
+	void benchProgram();
+};
@@ -28,11 +28,48 @@ class BigDouble : public IBigNum
 	/// Cut all last zeros from fractional part.
 	void cutExcessZeros();
 
+	/// Writes sum of this big double and number intB * 10^-commaB to res.
+	/// Only the operand with shorter fractional part is copied for alignment.
+	/// @param negate subtract the number instead of adding it.
+	void addInto(BigDouble& res, const BigInt& intB, size_t commaB, bool negate) const;
+
+	/// Writes product of this big double and number intB * 10^-commaB to res.
+	void mulInto(BigDouble& res, const BigInt& intB, size_t commaB) const;
+
+	/// Writes quotient of this big double and number intB * 10^-commaB to res,
+	/// digits after the given count of fractional digits are cut off.
+	/// @param precision count of fractional digits of quotient.
+	void divInto(BigDouble& res, const BigInt& intB, size_t commaB, size_t precision) const;
+
+	/// Writes reminder of this big double and number intB * 10^-commaB to res.
+	/// Reminder is exact and has the sign of divisor, as for big integers.
+	void modInto(BigDouble& res, const BigInt& intB, size_t commaB) const;
+
+	/// Gives digits and comma point of big number, integer has no fractional digits.
+	/// @param num pointer to big number.
+	/// @param[out] comma comma point of number.
+	/// @return all digits of number as big integer.
+	static const BigInt& splitNum(const IBigNum_ptr& num, size_t& comma);
+
+	/// Gives result of operation as big integer, if it has no fractional part.
+	/// @param res result, its limbs are moved to returned number.
+	static IBigNum_ptr toBigNum(BigDouble& res);
+
 public:
+	/// \var DEFAULT_PRECISION
+	/// Count of fractional digits of quotient, when it isn't given.
+	static constexpr size_t DEFAULT_PRECISION = 50;
+
 	/// Standard constructor of big double.
 	/// Assigns value to zero.
 	BigDouble():commaPoint(0) {}
 
+	/// Constructor of big double.
+	/// Makes number num * 10^-comma from its digits.
+	/// @param num all digits as big integer.
+	/// @param comma count of fractional digits.
+	BigDouble(const BigInt& num, size_t comma) : intPart(num), commaPoint(comma) {}
+
 	/// Constructor of big double.
 	/// Convert string to big double and then assigns it to this.
 	/// @param num string with number.
@@ -41,7 +78,16 @@ public:
 	/// Constructor of big double.
 	/// Copies another big double to this.
 	/// @param num another big double.
-	BigDouble(const BigDouble& num);
+	BigDouble(const BigDouble& num) = default;
+
+	/// Constructor of big double.
+	/// Takes limbs of another big double without copying.
+	/// @param num another big double.
+	BigDouble(BigDouble&& num) noexcept = default;
+
+	BigDouble& operator=(const BigDouble& num) = default;
+
+	BigDouble& operator=(BigDouble&& num) noexcept = default;
 
 	/// Converts this big double to string format in 10 notation
 	/// @param zeroMinus show zero with its sign (without plus).
@@ -56,7 +102,7 @@ public:
 	/// Doesn't change this big double.
 	/// @param num2 second big double.
 	/// @return result of operation.
-	BigDouble addBigDouble(BigDouble num2) const;
+	BigDouble addBigDouble(const BigDouble& num2) const;
 
 	/// Method for subtraction this big double and second big double.
 	/// Doesn't change this big double.
@@ -70,6 +116,13 @@ public:
 	/// @return result of operation.
 	BigDouble multiplyBigDouble(const BigDouble& num2) const;
 
+	/// Method for division this big double by another big number.
+	/// Doesn't change this big double.
+	/// @param num2 pointer to divisor, big integer or big double.
+	/// @param precision count of fractional digits of quotient, the next digits are cut off.
+	/// @return pointer to quotient, big integer if it has no fractional part.
+	IBigNum_ptr divide(const IBigNum_ptr& num2, size_t precision) const;
+
 	/// Multiplies this big integer by -1.
 	void timesMinusOne() { intPart.timesMinusOne(); }
 
@@ -98,17 +151,57 @@ public:
 	IBigNum_ptr operator*(const IBigNum_ptr& num2) const;
 
 	/// Operator for division of two big numbers.
-	/// This version only throws an exception of prohibited division with big doubles.
+	/// Quotient has DEFAULT_PRECISION fractional digits.
 	/// @param num2 pointer so second big number.
 	/// @return pointer to result of operation (also big number).
 	IBigNum_ptr operator/(const IBigNum_ptr& num2) const;
 
 	/// Operator for modding of two big numbers.
-	/// This version only throws an exception of prohibited modding with big doubles.
+	/// Reminder is exact and has the sign of divisor.
 	/// @param num2 pointer so second big number.
 	/// @return pointer to result of operation (also big number).
 	IBigNum_ptr operator%(const IBigNum_ptr& num2) const;
 
+	/// Method for raising big double to a power.
+	/// @param num2 pointer to exponent, it must be non-negative big integer.
+	/// @return pointer to result of operation (also big number).
+	IBigNum_ptr power(const IBigNum_ptr& num2) const;
+
+	/// Operator for shifting big number to the left.
+	/// This version only throws an exception of prohibited shifting with big doubles.
+	/// @param num2 pointer to count of bits.
+	/// @return pointer to result of operation (also big number).
+	IBigNum_ptr operator<<(const IBigNum_ptr& num2) const;
+
+	/// Operator for shifting big number to the right.
+	/// This version only throws an exception of prohibited shifting with big doubles.
+	/// @param num2 pointer to count of bits.
+	/// @return pointer to result of operation (also big number).
+	IBigNum_ptr operator>>(const IBigNum_ptr& num2) const;
+
+	/// Operator for bitwise AND of two big numbers.
+	/// This version only throws an exception of prohibited bitwise operations with big doubles.
+	/// @param num2 pointer so second big number.
+	/// @return pointer to result of operation (also big number).
+	IBigNum_ptr operator&(const IBigNum_ptr& num2) const;
+
+	/// Operator for bitwise OR of two big numbers.
+	/// This version only throws an exception of prohibited bitwise operations with big doubles.
+	/// @param num2 pointer so second big number.
+	/// @return pointer to result of operation (also big number).
+	IBigNum_ptr operator|(const IBigNum_ptr& num2) const;
+
+	/// Operator for bitwise XOR of two big numbers.
+	/// This version only throws an exception of prohibited bitwise operations with big doubles.
+	/// @param num2 pointer so second big number.
+	/// @return pointer to result of operation (also big number).
+	IBigNum_ptr operator^(const IBigNum_ptr& num2) const;
+
+	/// Operator for bitwise NOT of big number.
+	/// This version only throws an exception of prohibited bitwise operations with big doubles.
+	/// @return pointer to result of operation (also big number).
+	IBigNum_ptr operator~() const;
+
 	/// Operator for assigning big number.
 	/// @param num string with a number.
 	/// @return reference to current big double.
@@ -6,6 +6,7 @@
 #pragma once
 
 #include "IBigNum.h"
+#include "LimbVector.h"
 
 #include<vector>
 #include<string>
@@ -14,34 +15,86 @@
 /// \class BigInt
 /// \brief Class implementing for big integer number.
 /// 
-/// Represents big integer as an array of uint32 in notation 2^32.
+/// Represents big integer as an array of limbs in notation 2^LIMB_BITS.
 /// Derived from IBigNum.
 /// 
 class BigInt : public IBigNum
 {
 	/// \var bigNum
-	/// Array, which contains the number in notation 2^32 without a sign.
-	std::vector<uint32_t> bigNum;
+	/// Array, which contains the number in notation 2^LIMB_BITS without a sign.
+	LimbVector bigNum;
 
 	/// \var isMinus
 	/// Sign of the number. True if number is negative.
 	bool isMinus;
 
-	/// Derives this big integer by simple uint32.
-	/// Doesn't change this big number.
-	/// @param num divider.
-	/// @return pair of quotient and reminder.
-	std::pair<BigInt, uint32_t> divInt(uint32_t num) const;
-
-	/// Shifts all elements in array bigNum to right (n -> n + 1).
-	/// Equals to multiplying big integer by (uint32_max + 1).
-	/// Changes this big number.
-	void shiftR();
-
 	/// Converts string with number in 10 notation to big integer and 
 	/// assigns result to this big integer.
 	/// @param st string with number.
 	void stringToNum(const std::string& st);
+
+	/// Removes high zero limbs, at least one limb is kept.
+	void trim();
+
+	/// Writes sum or difference of two big integers to dst.
+	/// dst may be the same object as a or b.
+	/// @param negate subtract b instead of adding it.
+	static void addInto(BigInt& dst, const BigInt& a, const BigInt& b, bool negate);
+
+	/// Writes bitwise operation of two big integers in two's complement to dst.
+	/// dst may be the same object as a or b.
+	/// @param op one of symbols '&', '|' and '^'.
+	static void bitwiseInto(BigInt& dst, const BigInt& a, const BigInt& b, char op);
+
+	/// Writes x * p - y * q to dst for limbs p and q.
+	static void mulSubInto(BigInt& dst, const BigInt& x, limb_t p, const BigInt& y, limb_t q);
+
+	/// Multiplies pair (x, y) by 2x2 matrix m, which is written by columns:
+	/// x goes to m[0] * x + m[2] * y, y goes to m[1] * x + m[3] * y.
+	static void applyMatrix(const BigInt (&m)[4], BigInt& x, BigInt& y);
+
+	/// Makes one or several steps of Euclid's algorithm for a >= b > 0.
+	/// Steps are found by Lehmer simulation, or one division is made.
+	/// @param pairs count pairs of cofactors (pairs[2i], pairs[2i + 1]), which change as (a, b).
+	/// @param lehmer allow Lehmer steps, which may reduce numbers by several limbs.
+	static void euclidStep(BigInt& a, BigInt& b, BigInt* pairs, size_t count, bool lehmer);
+
+	/// Half-GCD: reduces a >= b > 0 with n limbs by Euclid steps while b has more than n / 2 + 1 limbs.
+	/// High halves are reduced recursively, matrices of steps are applied to whole numbers by multiplication.
+	/// @param[out] m matrix of reduction by columns, new (a, b) is m * (a, b).
+	/// @return false if b is already short enough, then m is identity.
+	static bool hgcd(BigInt& a, BigInt& b, BigInt (&m)[4]);
+
+	/// Reduces a and b by matrix, which half-GCD finds for their high limbs starting with limb p.
+	/// Steps for high limbs may be wrong for the last ones, so signs and order are fixed after.
+	/// @return false if high limbs are not reduced, then m is identity.
+	static bool hgcdHigh(BigInt& a, BigInt& b, BigInt (&m)[4], size_t p);
+
+	/// Reduces a >= b >= 0 to (gcd, 0).
+	/// @param u pair of cofactors, which changes as (a, b), or nullptr.
+	static void gcdReduce(BigInt& a, BigInt& b, BigInt* u);
+
+	/// Writes floor(n^(1/k)) to dst for n >= 0 and 1 <= k < bit length of n.
+	/// Root of high bits of n gives half of bits of the root, one Newton step from it gives the rest.
+	static void rootAbs(BigInt& dst, const BigInt& n, size_t k);
+
+	/// Writes Fibonacci numbers F(n) to f and F(n - 1) to f1 by fast doubling,
+	/// each bit of n costs two squarings.
+	static void fibPair(BigInt& f, BigInt& f1, uint32_t n);
+
+	/// Converts index of Fibonacci or Lucas number to 32 bits with sign.
+	/// @throw std::runtime_error if absolute value doesn't fit into 32 bits.
+	static uint32_t toSequenceIndex(const BigInt& n, const std::string& sequence);
+
+	/// Finds Selfridge's parameter D for odd n without small prime factors
+	/// and runs Baillie-PSW test of n.
+	/// @return false if n is composite.
+	static bool strongPrimeTest(const BigInt& n);
+
+	/// Converts this big integer to count of bits for shift operators.
+	/// @param saturate if true, too big count is returned as SIZE_MAX instead of error.
+	/// @throw std::runtime_error if number is negative or too big and not saturated.
+	size_t toShiftCount(bool saturate = false) const;
 public:
 	/// Compares if absolute value of this big integer is less than absolute value of another big integer.
 	/// @param num2 another big integer.
@@ -93,6 +146,15 @@ public:
 		stringToNum(st);
 	}
 
+	/// Copy constructor of big integer.
+	/// @param num2 another big integer.
+	BigInt(const BigInt& num2) = default;
+
+	/// Move constructor of big integer.
+	/// Takes limbs of another big integer without copying.
+	/// @param num2 another big integer, which is left empty.
+	BigInt(BigInt&& num2) noexcept = default;
+
 	/// Converts this big integer to string format in 10 notation
 	/// @param zeroMinus show zero with its sign (without plus).
 	/// @return string with number.
@@ -102,6 +164,9 @@ public:
 	/// @return true if number is negative.
 	bool checkMinus() const { return isMinus; }
 
+	/// Counts bits of absolute value of this big integer, zero has no bits.
+	size_t bitLength() const;
+
 	/// Checks if this number equals to zero.
 	/// Sign nevermind.
 	/// @return true if is zero.
@@ -111,7 +176,7 @@ public:
 	/// Doesn't change this big integer.
 	/// @param num2 second big integer.
 	/// @return result of operation.
-	BigInt addBigInt(BigInt num2) const;
+	BigInt addBigInt(const BigInt& num2) const;
 
 	/// Method for subtraction this big integer and second big integer.
 	/// Doesn't change this big integer.
@@ -125,12 +190,179 @@ public:
 	/// @return result of operation.
 	BigInt multiplyBigInt(const BigInt& num2) const;
 
+	/// Method for raising this big integer to a power.
+	/// Doesn't change this big integer.
+	/// @param num2 exponent, non-negative big integer.
+	/// @return result of operation.
+	BigInt powerBigInt(const BigInt& num2) const;
+
 	/// Method for division this big integer by second big integer.
 	/// Doesn't change this big integer.
 	/// @param num second big integer.
 	/// @return quotient and reminder.
 	std::pair<BigInt, BigInt> divide(const BigInt& num) const;
 
+	/// Adds second big integer to this big integer.
+	/// Memory is allocated only if sum doesn't fit into this number.
+	/// @param num2 second big integer, may be this number.
+	/// @return reference to this big integer.
+	BigInt& addInPlace(const BigInt& num2);
+
+	/// Subtracts second big integer from this big integer.
+	/// @param num2 second big integer, may be this number.
+	/// @return reference to this big integer.
+	BigInt& subInPlace(const BigInt& num2);
+
+	/// Writes a + b to dst, dst may be the same object as a or b.
+	static void addInto(BigInt& dst, const BigInt& a, const BigInt& b) { addInto(dst, a, b, false); }
+
+	/// Writes a - b to dst, dst may be the same object as a or b.
+	static void subInto(BigInt& dst, const BigInt& a, const BigInt& b) { addInto(dst, a, b, true); }
+
+	/// Writes a * b to dst.
+	/// If dst is a or b, product is computed in temporary number.
+	static void mulInto(BigInt& dst, const BigInt& a, const BigInt& b);
+
+	/// Divides a by b with rounding down and writes quotient to q and reminder to r.
+	/// Reminder has the sign of divisor. q and r may be the same objects as a or b.
+	/// @throw std::runtime_error if b is zero.
+	static void divmodInto(BigInt& q, BigInt& r, const BigInt& a, const BigInt& b);
+
+	/// Writes reciprocal of modulus m to inv for repeated reductions by modBarrettInto.
+	/// Moduli shorter than limbs::barrettThreshold get zero, they are reduced by division.
+	/// @throw std::runtime_error if m is zero.
+	static void barrettReciprocalInto(BigInt& inv, const BigInt& m);
+
+	/// Writes a % m to dst, reminder has the sign of m as for operator %.
+	/// Barrett's reduction by reciprocal inv of m needs two multiplications instead of a division.
+	/// dst may be the same object as a.
+	static void modBarrettInto(BigInt& dst, const BigInt& a, const BigInt& m, const BigInt& inv);
+
+	/// Writes greatest common divisor of absolute values of a and b to dst.
+	/// Lehmer's algorithm is used for medium numbers, half-GCD for big ones.
+	static void gcdInto(BigInt& dst, const BigInt& a, const BigInt& b);
+
+	/// Extended Euclid's algorithm: writes g = gcd(a, b) and cofactor s,
+	/// such that g = s * a + t * b for some integer t.
+	/// s is reduced to [0, |b| / g) for nonzero b.
+	static void gcdExtInto(BigInt& g, BigInt& s, const BigInt& a, const BigInt& b);
+
+	/// Writes least common multiple of absolute values of a and b to dst.
+	static void lcmInto(BigInt& dst, const BigInt& a, const BigInt& b);
+
+	/// Writes inverse of a modulo m to dst, it has the sign of m as reminder of division.
+	/// @throw std::runtime_error if m is zero or a and m are not coprime.
+	static void modInvInto(BigInt& dst, const BigInt& a, const BigInt& m);
+
+	/// Writes integer square root floor(sqrt(n)) to dst.
+	/// @throw std::runtime_error if n is negative.
+	static void sqrtInto(BigInt& dst, const BigInt& n);
+
+	/// Writes integer k-th root of n to dst, it is rounded towards zero.
+	/// Newton iteration doubles precision from a root of high bits,
+	/// so it costs a few multiplications and divisions of full size.
+	/// @throw std::runtime_error if k is not positive or n is negative for even k.
+	static void rootInto(BigInt& dst, const BigInt& n, const BigInt& k);
+
+	/// Writes n! to dst. Primes of the result are grouped by bits of their exponents,
+	/// so it is made of squarings and balanced product trees.
+	/// @throw std::runtime_error if n is negative or doesn't fit into 32 bits.
+	static void factorialInto(BigInt& dst, const BigInt& n);
+
+	/// Writes binomial coefficient C(n, k) to dst, it is zero for k < 0 and k > n >= 0.
+	/// Negative n gives (-1)^k * C(k - n - 1, k).
+	/// @throw std::runtime_error if min(k, n - k) doesn't fit into 32 bits.
+	static void binomialInto(BigInt& dst, const BigInt& n, const BigInt& k);
+
+	/// Writes Fibonacci number F(n) to dst, F(-n) = (-1)^(n + 1) * F(n).
+	/// @throw std::runtime_error if |n| doesn't fit into 32 bits.
+	static void fibonacciInto(BigInt& dst, const BigInt& n);
+
+	/// Writes Lucas number L(n) = F(n) + 2 * F(n - 1) to dst, L(-n) = (-1)^n * L(n).
+	/// @throw std::runtime_error if |n| doesn't fit into 32 bits.
+	static void lucasInto(BigInt& dst, const BigInt& n);
+
+	/// Checks if n is prime by trial division over small primes and Baillie-PSW test,
+	/// which has no known pseudoprimes. Negative numbers are not prime.
+	static bool isPrime(const BigInt& n);
+
+	/// Writes the least prime greater than n to dst.
+	/// Candidates are sieved by small primes in windows, only the rest are tested.
+	static void nextPrimeInto(BigInt& dst, const BigInt& n);
+
+	/// Converts this big integer to exponent for power.
+	/// Powers of 0, 1 and -1 depend only on parity of exponent, so it can be of any size.
+	/// @param unitBase base is 0, 1 or -1.
+	/// @return exponent or, for unit base, the least exponent with the same power.
+	/// @throw std::runtime_error if number is negative or too big.
+	uint64_t toExponent(bool unitBase) const;
+
+	/// Writes base^exp to dst by left-to-right sliding window exponentiation.
+	/// dst may be the same object as base.
+	static void powInto(BigInt& dst, const BigInt& base, uint64_t exp);
+
+	/// Writes base^exp mod m to dst, reminder has the sign of m as for operator %.
+	/// Odd modulus uses Montgomery multiplication, the context is made once per call.
+	/// @throw std::runtime_error if exp is negative or m is zero.
+	static void powModInto(BigInt& dst, const BigInt& base, const BigInt& exp, const BigInt& m);
+
+	/// Multiplies this big integer by one limb.
+	void mulLimbInPlace(limb_t num);
+
+	/// Divides absolute value of this big integer by one limb.
+	/// @return reminder.
+	limb_t divLimbInPlace(limb_t num);
+
+	/// Computes reminder of absolute value of this big integer by one limb.
+	limb_t modLimb(limb_t num) const;
+
+	/// Writes a * 10^k to dst.
+	/// Short powers are multiplied by limbs, memory for dst is allocated once,
+	/// long ones are taken from shared cache of powers and multiplied at once.
+	static void mulPow10Into(BigInt& dst, const BigInt& a, size_t k);
+
+	/// Divides this big integer by the greatest 10^j, which divides it, with j <= maxZeros.
+	/// Powers 5^(2^i) from shared cache are tried from the largest,
+	/// so only logarithmic count of exact divisions is needed.
+	/// @return j, zero number gives maxZeros.
+	size_t stripPow10(size_t maxZeros);
+
+	/// Multiplies this big integer by 2^bits.
+	/// Whole limbs and bits inside limb are shifted by one pass.
+	void shiftLeft(size_t bits);
+
+	/// Divides this big integer by 2^bits with rounding down,
+	/// so negative numbers are shifted as in two's complement.
+	void shiftRight(size_t bits);
+
+	BigInt& operator+=(const BigInt& num2) { return addInPlace(num2); }
+
+	BigInt& operator-=(const BigInt& num2) { return subInPlace(num2); }
+
+	BigInt& operator*=(const BigInt& num2) { mulInto(*this, *this, num2); return *this; }
+
+	/// Method for bitwise AND of this big integer and second big integer.
+	/// Negative numbers are considered in two's complement with infinite sign bits.
+	/// @param num2 second big integer.
+	/// @return result of operation.
+	BigInt andBigInt(const BigInt& num2) const;
+
+	/// Method for bitwise OR of this big integer and second big integer.
+	/// Negative numbers are considered in two's complement with infinite sign bits.
+	/// @param num2 second big integer.
+	/// @return result of operation.
+	BigInt orBigInt(const BigInt& num2) const;
+
+	/// Method for bitwise XOR of this big integer and second big integer.
+	/// Negative numbers are considered in two's complement with infinite sign bits.
+	/// @param num2 second big integer.
+	/// @return result of operation.
+	BigInt xorBigInt(const BigInt& num2) const;
+
+	/// Method for bitwise NOT of this big integer, which equals to -x - 1.
+	/// @return result of operation.
+	BigInt notBigInt() const;
+
 	/// Multiplies this big integer by -1.
 	void timesMinusOne() { isMinus = !isMinus; }
 
@@ -168,6 +400,40 @@ public:
 	/// @return pointer to result of operation (also big number).
 	IBigNum_ptr operator%(const IBigNum_ptr& num2) const;
 
+	/// Method for raising big integer to a power.
+	/// @param num2 pointer to exponent, it must be non-negative big integer.
+	/// @return pointer to result of operation (also big number).
+	IBigNum_ptr power(const IBigNum_ptr& num2) const;
+
+	/// Operator for shifting big integer to the left.
+	/// @param num2 pointer to count of bits, it must be big integer.
+	/// @return pointer to result of operation (also big number).
+	IBigNum_ptr operator<<(const IBigNum_ptr& num2) const;
+
+	/// Operator for shifting big integer to the right.
+	/// @param num2 pointer to count of bits, it must be big integer.
+	/// @return pointer to result of operation (also big number).
+	IBigNum_ptr operator>>(const IBigNum_ptr& num2) const;
+
+	/// Operator for bitwise AND of two big numbers.
+	/// @param num2 pointer so second big number, it must be big integer.
+	/// @return pointer to result of operation (also big number).
+	IBigNum_ptr operator&(const IBigNum_ptr& num2) const;
+
+	/// Operator for bitwise OR of two big numbers.
+	/// @param num2 pointer so second big number, it must be big integer.
+	/// @return pointer to result of operation (also big number).
+	IBigNum_ptr operator|(const IBigNum_ptr& num2) const;
+
+	/// Operator for bitwise XOR of two big numbers.
+	/// @param num2 pointer so second big number, it must be big integer.
+	/// @return pointer to result of operation (also big number).
+	IBigNum_ptr operator^(const IBigNum_ptr& num2) const;
+
+	/// Operator for bitwise NOT of big integer.
+	/// @return pointer to result of operation (also big number).
+	IBigNum_ptr operator~() const;
+
 	/// Operator for assigning big number.
 	/// @param num string with a number.
 	/// @return reference to current big number.
@@ -178,6 +444,12 @@ public:
 	/// @return reference to current big number.
 	BigInt& operator=(const BigInt& num2);
 
+	/// Operator for moving big integer.
+	/// Takes limbs of another big integer without copying.
+	/// @param num2 another big integer.
+	/// @return reference to current big number.
+	BigInt& operator=(BigInt&& num2) noexcept;
+
 	/// Compares if this big integer is less than another big integer.
 	/// @param num2 another big integer.
 	/// @return if this is less than second.
@@ -32,13 +32,31 @@ class Evaluator
 		number = 0,
 		constant,
 		operation,
+		unaryOperation,
 		function,
 		variable,
 		openBracket,
 		closeBracket,
+		separator,
 		error
 	};
 
+	///
+	/// \struct CachedModulus
+	/// \brief Reciprocal of variable, which is used as modulus of operator %.
+	///
+	struct CachedModulus
+	{
+		/// \var modulus
+		/// Value of variable, for which reciprocal is computed.
+		/// The pointer keeps value alive, so its address can't be taken by another number.
+		IBigNum_ptr modulus;
+
+		/// \var reciprocal
+		/// Reciprocal for Barrett's reduction, zero for short moduli.
+		BigInt reciprocal;
+	};
+
 	/// \var prohibitedVarNames 
 	/// The list with prohibited variable names
 	std::vector<std::string> prohibitedVarNames;
@@ -47,10 +65,22 @@ class Evaluator
 	/// The list with variables
 	std::map<std::string, IBigNum_ptr> variables;
 
+	/// \var moduli
+	/// Reciprocals of variables used as modulus, entry is removed when variable is assigned.
+	std::map<std::string, CachedModulus> moduli;
+
 	/// \var constants
 	/// The list with constants
 	std::map<std::string, IBigNum_ptr> constants;
 
+	/// \var precision
+	/// Count of fractional digits of quotient, when big double is divided.
+	size_t precision = BigDouble::DEFAULT_PRECISION;
+
+	/// \var functions
+	/// The list with built-in functions and counts of their arguments
+	std::map<std::string, size_t> functions;
+
 	/// \var outputQ
 	/// Contains all tokens ordered in reverse polish notation.
 	std::queue<std::pair<std::string, TokenType>> outputQ;
@@ -59,6 +89,11 @@ class Evaluator
 	/// Temporary stack for containing operation and bracket tokens.
 	std::stack<std::pair<std::string, TokenType>> funcStack;
 
+	/// \var argCounts
+	/// Count of arguments read for each open bracket,
+	/// zero for brackets, which don't belong to function.
+	std::stack<size_t> argCounts;
+
 	/// \var Current index of symbol in processing string.
 	/// @see Evaluate
 	size_t iter;
@@ -73,6 +108,9 @@ class Evaluator
 	/// Initializes some constants to constants map.
 	void initConstants();
 
+	/// Initializes built-in functions to functions map.
+	void initFunctions();
+
 	/// Checks if variable name satisfying all rules and
 	/// prepares it for using (delete spaces in front and in back).
 	/// @param[in, out] name variable name.
@@ -112,6 +150,20 @@ class Evaluator
 	/// @return pointer to resulting big number.
 	IBigNum_ptr compute(IBigNum_ptr num1, IBigNum_ptr num2,const std::string& op);
 
+	/// Computes num1 % num2, where num2 is value of variable.
+	/// Reciprocal of the variable is cached, so repeated reductions need no division.
+	/// @param num1 pointer to dividend.
+	/// @param num2 pointer to value of variable.
+	/// @param[in] varName name of variable.
+	/// @return pointer to reminder.
+	IBigNum_ptr computeMod(IBigNum_ptr num1, IBigNum_ptr num2, const std::string& varName);
+
+	/// Computes built-in function.
+	/// @param[in] name name of function.
+	/// @param args pointers to arguments, their count is already checked.
+	/// @return pointer to resulting big number.
+	IBigNum_ptr callFunction(const std::string& name, const std::vector<IBigNum_ptr>& args);
+
 	// evaluating methods
 
 	/// Converts math expression to reverse polish notation.
@@ -123,7 +175,7 @@ class Evaluator
 	/// @return pointer to resulting big number
 	IBigNum_ptr evalRPN();
 
-	/// Resets outputQ, funcStack and iter.
+	/// Resets outputQ, funcStack, argCounts and iter.
 	void reset();
 
 public:
@@ -151,4 +203,12 @@ public:
 
 	/// Deletes all variables.
 	void clearAllVars();
+
+	/// Sets count of fractional digits of quotient, when big double is divided.
+	/// Division of two big integers is always integer.
+	/// @param digits count of digits.
+	void setPrecision(size_t digits) { precision = digits; }
+
+	/// @return count of fractional digits of quotient of big doubles.
+	size_t getPrecision() const { return precision; }
 };
\ No newline at end of file
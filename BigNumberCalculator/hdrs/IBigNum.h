@@ -68,6 +68,40 @@ public:
 	/// @return pointer to result of operation (also big number).
 	virtual IBigNum_ptr operator%(const IBigNum_ptr& num2) const = 0;
 
+	/// A pure virtual method for raising big number to a power.
+	/// @param num2 pointer to exponent, non-negative integer.
+	/// @return pointer to result of operation (also big number).
+	virtual IBigNum_ptr power(const IBigNum_ptr& num2) const = 0;
+
+	/// A pure virtual operator for shifting big number to the left by bits.
+	/// @param num2 pointer to count of bits.
+	/// @return pointer to result of operation (also big number).
+	virtual IBigNum_ptr operator<<(const IBigNum_ptr& num2) const = 0;
+
+	/// A pure virtual operator for shifting big number to the right by bits.
+	/// @param num2 pointer to count of bits.
+	/// @return pointer to result of operation (also big number).
+	virtual IBigNum_ptr operator>>(const IBigNum_ptr& num2) const = 0;
+
+	/// A pure virtual operator for bitwise AND of two big numbers.
+	/// @param num2 pointer so second big number.
+	/// @return pointer to result of operation (also big number).
+	virtual IBigNum_ptr operator&(const IBigNum_ptr& num2) const = 0;
+
+	/// A pure virtual operator for bitwise OR of two big numbers.
+	/// @param num2 pointer so second big number.
+	/// @return pointer to result of operation (also big number).
+	virtual IBigNum_ptr operator|(const IBigNum_ptr& num2) const = 0;
+
+	/// A pure virtual operator for bitwise XOR of two big numbers.
+	/// @param num2 pointer so second big number.
+	/// @return pointer to result of operation (also big number).
+	virtual IBigNum_ptr operator^(const IBigNum_ptr& num2) const = 0;
+
+	/// A pure virtual operator for bitwise NOT of big number.
+	/// @return pointer to result of operation (also big number).
+	virtual IBigNum_ptr operator~() const = 0;
+
 	/// A pure virtual operator for assigning big number.
 	/// @param num string with a number.
 	/// @return reference to current big number.
@@ -0,0 +1,71 @@
+/**
+* @file Kernels.h
+* File with description of inner loops of limb arithmetic,
+* which have versions for different instruction sets.
+*/
+
+#pragma once
+
+#include "Limbs.h"
+
+#if !defined(BIGNUM_LIMB32) && (defined(__x86_64__) || defined(_M_X64))
+/// Vector kernels for x86-64 are compiled, they work only with 64-bit limbs.
+#define KERNELS_X86
+#endif
+
+///
+/// \namespace kernels
+/// \brief Hot loops of limbs functions with runtime choice of instruction set.
+///
+/// Each instruction set has a table of kernels. The best table, which
+/// processor supports, is chosen by CPUID on the first call of active().
+/// Scalar kernels are always available.
+///
+namespace kernels
+{
+	/// Instruction sets, for which kernels exist.
+	enum class Isa
+	{
+		scalar,
+		avx2,
+		avx512
+	};
+
+	/// Set of kernels for one instruction set.
+	/// Kernels have the same contracts as limbs functions with the same names.
+	struct Table
+	{
+		/// Name of instruction set for printing.
+		const char* name;
+
+		int (*cmp)(const limb_t* a, const limb_t* b, size_t n);
+
+		limb_t (*addN)(limb_t* r, const limb_t* a, const limb_t* b, size_t n);
+
+		limb_t (*subN)(limb_t* r, const limb_t* a, const limb_t* b, size_t n);
+
+		limb_t (*addMul1)(limb_t* r, const limb_t* a, size_t n, limb_t b);
+	};
+
+	/// Portable kernels.
+	extern const Table scalarTable;
+
+#ifdef KERNELS_X86
+	/// Kernels with AVX2 and BMI2 instructions.
+	extern const Table avx2Table;
+
+	/// Kernels with AVX-512F instructions.
+	extern const Table avx512Table;
+#endif
+
+	/// Gives kernels for instruction set.
+	/// @return nullptr if processor or build doesn't support the instruction set.
+	const Table* get(Isa isa);
+
+	/// Gives kernels, which are used by limbs functions.
+	const Table& active();
+
+	/// Changes kernels, which are used by limbs functions.
+	/// @return false if instruction set isn't supported.
+	bool select(Isa isa);
+}
@@ -0,0 +1,209 @@
+/**
+* @file LimbVector.h
+* File with description of class LimbVector
+*/
+
+#pragma once
+
+#include "Limbs.h"
+
+#include <algorithm>
+#include <new>
+
+///
+/// \class LimbVector
+/// \brief Array of limbs with small buffer.
+///
+/// Keeps up to INLINE_LIMBS limbs inside the object and allocates
+/// heap memory only for longer numbers. Interface is a subset of std::vector.
+///
+class LimbVector
+{
+public:
+	/// \var INLINE_LIMBS
+	/// Count of limbs, which are stored without heap allocation.
+	static constexpr size_t INLINE_LIMBS = 4;
+
+private:
+	/// \var ptr
+	/// Pointer to limbs, either to local or to heap memory.
+	limb_t* ptr;
+
+	/// \var len
+	/// Count of limbs in array.
+	size_t len;
+
+	/// \var cap
+	/// Count of limbs, which fit into current memory.
+	size_t cap;
+
+	/// \var local
+	/// Inline buffer for short numbers.
+	limb_t local[INLINE_LIMBS];
+
+	/// Checks if limbs are in heap memory.
+	bool onHeap() const { return ptr != local; }
+
+	/// Moves limbs to memory with at least n limbs.
+	/// @param n required capacity.
+	void grow(size_t n)
+	{
+		size_t newCap = std::max(n, 2 * cap);
+		limb_t* mem = static_cast<limb_t*>(::operator new(newCap * sizeof(limb_t)));
+
+		std::copy(ptr, ptr + len, mem);
+		if (onHeap())
+			::operator delete(ptr);
+
+		ptr = mem;
+		cap = newCap;
+	}
+
+	/// Takes limbs of another array, which is left empty.
+	void steal(LimbVector& other) noexcept
+	{
+		if (other.onHeap())
+		{
+			ptr = other.ptr;
+			cap = other.cap;
+			other.ptr = other.local;
+			other.cap = INLINE_LIMBS;
+		}
+		else
+		{
+			ptr = local;
+			cap = INLINE_LIMBS;
+			std::copy(other.local, other.local + other.len, local);
+		}
+
+		len = other.len;
+		other.len = 0;
+	}
+
+public:
+	typedef limb_t value_type;
+	typedef limb_t* iterator;
+	typedef const limb_t* const_iterator;
+
+	/// Makes empty array.
+	LimbVector() noexcept
+		:
+		ptr(local), len(0), cap(INLINE_LIMBS)
+	{
+	}
+
+	/// Makes array of n limbs with given value.
+	LimbVector(size_t n, limb_t value = 0)
+		:
+		LimbVector()
+	{
+		assign(n, value);
+	}
+
+	/// Copies array.
+	LimbVector(const LimbVector& other)
+		:
+		LimbVector()
+	{
+		*this = other;
+	}
+
+	/// Moves array, heap memory is taken without copying.
+	LimbVector(LimbVector&& other) noexcept
+	{
+		steal(other);
+	}
+
+	~LimbVector()
+	{
+		if (onHeap())
+			::operator delete(ptr);
+	}
+
+	LimbVector& operator=(const LimbVector& other)
+	{
+		if (this != &other)
+		{
+			len = 0;
+			if (cap < other.len)
+				grow(other.len);
+
+			std::copy(other.ptr, other.ptr + other.len, ptr);
+			len = other.len;
+		}
+
+		return *this;
+	}
+
+	LimbVector& operator=(LimbVector&& other) noexcept
+	{
+		if (this != &other)
+		{
+			if (onHeap())
+				::operator delete(ptr);
+
+			steal(other);
+		}
+
+		return *this;
+	}
+
+	size_t size() const { return len; }
+
+	bool empty() const { return len == 0; }
+
+	limb_t* data() { return ptr; }
+
+	const limb_t* data() const { return ptr; }
+
+	limb_t& operator[](size_t i) { return ptr[i]; }
+
+	const limb_t& operator[](size_t i) const { return ptr[i]; }
+
+	limb_t& back() { return ptr[len - 1]; }
+
+	const limb_t& back() const { return ptr[len - 1]; }
+
+	iterator begin() { return ptr; }
+
+	iterator end() { return ptr + len; }
+
+	const_iterator begin() const { return ptr; }
+
+	const_iterator end() const { return ptr + len; }
+
+	/// Reserves memory for n limbs.
+	void reserve(size_t n)
+	{
+		if (n > cap)
+			grow(n);
+	}
+
+	/// Changes count of limbs, new limbs get given value.
+	void resize(size_t n, limb_t value = 0)
+	{
+		reserve(n);
+		if (n > len)
+			std::fill(ptr + len, ptr + n, value);
+		len = n;
+	}
+
+	/// Replaces limbs with n limbs of given value.
+	void assign(size_t n, limb_t value)
+	{
+		len = 0;
+		resize(n, value);
+	}
+
+	void push_back(limb_t x)
+	{
+		if (len == cap)
+			grow(len + 1);
+		ptr[len++] = x;
+	}
+
+	void pop_back() { len--; }
+
+	/// Removes all limbs, memory is kept.
+	void clear() { len = 0; }
+};
@@ -0,0 +1,414 @@
+/**
+* @file Limbs.h
+* File with description of low-level arithmetic over arrays of limbs.
+*/
+
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+
+#if defined(BIGNUM_LIMB32)
+
+/// Type of one digit (limb) of big integer.
+typedef uint32_t limb_t;
+
+/// Type which can hold a product of two limbs.
+typedef uint64_t dlimb_t;
+
+/// Count of bits in one limb.
+constexpr unsigned LIMB_BITS = 32;
+
+#else
+
+/// Type of one digit (limb) of big integer.
+typedef uint64_t limb_t;
+
+#if defined(_MSC_VER)
+// MSVC has no 128-bit integer, carries and wide products go through intrinsics
+#include <intrin.h>
+#define LIMBS_MSVC_INTRINSICS
+#else
+/// Type which can hold a product of two limbs.
+__extension__ typedef unsigned __int128 dlimb_t;
+#endif
+
+/// Count of bits in one limb.
+constexpr unsigned LIMB_BITS = 64;
+
+#endif
+
+///
+/// \namespace limbs
+/// \brief Arithmetic over raw arrays of limbs.
+///
+/// All arrays are unsigned numbers in notation 2^LIMB_BITS,
+/// the least significant limb goes first.
+/// Functions don't allocate result memory, caller gives enough space.
+///
+namespace limbs
+{
+	/// \var karatsubaThreshold
+	/// Count of limbs of the shorter operand, from which
+	/// Karatsuba multiplication is used instead of schoolbook.
+	extern size_t karatsubaThreshold;
+
+	/// \var toom3Threshold
+	/// Count of limbs of the shorter operand, from which
+	/// Toom-3 multiplication is used instead of Karatsuba.
+	extern size_t toom3Threshold;
+
+	/// \var nttThreshold
+	/// Count of limbs of the shorter operand, from which
+	/// multiplication through number-theoretic transform is used.
+	extern size_t nttThreshold;
+
+	/// \var parallelThreshold
+	/// Count of limbs of the shorter operand, from which independent
+	/// products of recursive multiplication and halves of radix
+	/// conversion run on the thread pool.
+	extern size_t parallelThreshold;
+
+	/// \var bzThreshold
+	/// Count of limbs of divisor and quotient, from which
+	/// Burnikel-Ziegler division is used instead of schoolbook.
+	extern size_t bzThreshold;
+
+	/// \var newtonThreshold
+	/// Count of limbs of divisor and quotient, from which
+	/// division through Newton reciprocal is used.
+	extern size_t newtonThreshold;
+
+	/// \var barrettThreshold
+	/// Count of limbs of modulus, from which reduction by cached
+	/// reciprocal is used instead of division for repeated modulus.
+	extern size_t barrettThreshold;
+
+	/// \var radixThreshold
+	/// Count of limbs (nine decimal digits each), from which conversion
+	/// between decimal strings and limbs is done by divide and conquer.
+	extern size_t radixThreshold;
+
+	/// \var hgcdThreshold
+	/// Count of limbs, from which greatest common divisor is computed
+	/// by recursive half-GCD instead of Lehmer's algorithm.
+	extern size_t hgcdThreshold;
+
+	/// Adds limb with carry.
+	/// @param a first limb.
+	/// @param b second limb.
+	/// @param[in, out] carry incoming and outgoing carry (0 or 1).
+	/// @return low limb of sum.
+	inline limb_t addCarry(limb_t a, limb_t b, limb_t& carry)
+	{
+#ifdef LIMBS_MSVC_INTRINSICS
+		unsigned long long r;
+		carry = _addcarry_u64((unsigned char)carry, a, b, &r);
+		return r;
+#else
+		dlimb_t s = (dlimb_t)a + b + carry;
+		carry = (limb_t)(s >> LIMB_BITS);
+		return (limb_t)s;
+#endif
+	}
+
+	/// Subtracts limb with borrow.
+	/// @param a minuend.
+	/// @param b subtrahend.
+	/// @param[in, out] borrow incoming and outgoing borrow (0 or 1).
+	/// @return low limb of difference.
+	inline limb_t subBorrow(limb_t a, limb_t b, limb_t& borrow)
+	{
+#ifdef LIMBS_MSVC_INTRINSICS
+		unsigned long long r;
+		borrow = _subborrow_u64((unsigned char)borrow, a, b, &r);
+		return r;
+#else
+		dlimb_t d = (dlimb_t)a - b - borrow;
+		borrow = (limb_t)(d >> LIMB_BITS) & 1;
+		return (limb_t)d;
+#endif
+	}
+
+	/// Computes full product of two limbs.
+	/// @param a first factor.
+	/// @param b second factor.
+	/// @param[out] hi high limb of product.
+	/// @return low limb of product.
+	inline limb_t mulWide(limb_t a, limb_t b, limb_t& hi)
+	{
+#ifdef LIMBS_MSVC_INTRINSICS
+		unsigned long long h;
+		limb_t lo = _umul128(a, b, &h);
+		hi = h;
+		return lo;
+#else
+		dlimb_t t = (dlimb_t)a * b;
+		hi = (limb_t)(t >> LIMB_BITS);
+		return (limb_t)t;
+#endif
+	}
+
+	/// Computes a * b + c + carry.
+	/// Result always fits into two limbs.
+	/// @param a first factor.
+	/// @param b second factor.
+	/// @param c addend.
+	/// @param[in, out] carry incoming carry and high limb of result.
+	/// @return low limb of result.
+	inline limb_t mulAddCarry(limb_t a, limb_t b, limb_t c, limb_t& carry)
+	{
+#ifdef LIMBS_MSVC_INTRINSICS
+		limb_t hi, lo = mulWide(a, b, hi);
+		unsigned char k = _addcarry_u64(0, lo, c, &lo);
+		_addcarry_u64(k, hi, 0, &hi);
+		k = _addcarry_u64(0, lo, carry, &lo);
+		_addcarry_u64(k, hi, 0, &hi);
+		carry = hi;
+		return lo;
+#else
+		dlimb_t t = (dlimb_t)a * b + c + carry;
+		carry = (limb_t)(t >> LIMB_BITS);
+		return (limb_t)t;
+#endif
+	}
+
+	/// Divides two-limb number by one limb, hi must be less than d.
+	/// @param hi high limb of dividend.
+	/// @param lo low limb of dividend.
+	/// @param d divider.
+	/// @param[out] rem reminder.
+	/// @return quotient.
+	inline limb_t divWide(limb_t hi, limb_t lo, limb_t d, limb_t& rem)
+	{
+#ifdef LIMBS_MSVC_INTRINSICS
+		unsigned long long r;
+		limb_t q = _udiv128(hi, lo, d, &r);
+		rem = r;
+		return q;
+#else
+		dlimb_t t = ((dlimb_t)hi << LIMB_BITS) | lo;
+		rem = (limb_t)(t % d);
+		return (limb_t)(t / d);
+#endif
+	}
+
+	/// Counts zero bits before the highest set bit.
+	/// @param x nonzero limb.
+	/// @return count of leading zero bits.
+	inline unsigned countLeadingZeros(limb_t x)
+	{
+#if defined(__GNUC__)
+		return LIMB_BITS == 64 ? (unsigned)__builtin_clzll(x) : (unsigned)__builtin_clz((unsigned)x);
+#else
+		unsigned n = 0;
+		for (limb_t mask = (limb_t)1 << (LIMB_BITS - 1); !(x & mask); mask >>= 1)
+			n++;
+		return n;
+#endif
+	}
+
+	/// Compares two arrays of the same length.
+	/// @return -1, 0 or 1 as a is less, equal or greater than b.
+	int cmp(const limb_t* a, const limb_t* b, size_t n);
+
+	/// Computes r = a + b, all arrays have n limbs.
+	/// r may be the same array as a or b.
+	/// @return outgoing carry.
+	limb_t addN(limb_t* r, const limb_t* a, const limb_t* b, size_t n);
+
+	/// Computes r = a + b, where an >= bn, r has an limbs.
+	/// r may be the same array as a.
+	/// @return outgoing carry.
+	limb_t add(limb_t* r, const limb_t* a, size_t an, const limb_t* b, size_t bn);
+
+	/// Computes r = a - b, all arrays have n limbs.
+	/// r may be the same array as a or b.
+	/// @return outgoing borrow.
+	limb_t subN(limb_t* r, const limb_t* a, const limb_t* b, size_t n);
+
+	/// Computes r = a - b, where an >= bn, r has an limbs.
+	/// r may be the same array as a.
+	/// @return outgoing borrow.
+	limb_t sub(limb_t* r, const limb_t* a, size_t an, const limb_t* b, size_t bn);
+
+	/// Computes r = a * b for one limb b.
+	/// @return high limb of product.
+	limb_t mul1(limb_t* r, const limb_t* a, size_t n, limb_t b);
+
+	/// Computes r += a * b for one limb b, r and a have n limbs.
+	/// @return high limb, which didn't fit into r.
+	limb_t addMul1(limb_t* r, const limb_t* a, size_t n, limb_t b);
+
+	/// Computes r -= a * b for one limb b, r and a have n limbs.
+	/// @return high limb, which has to be subtracted from the next limb of r.
+	limb_t subMul1(limb_t* r, const limb_t* a, size_t n, limb_t b);
+
+	/// Shifts a to the left by 0 < s < LIMB_BITS bits.
+	/// Limbs are processed from the high one, so r may overlap a when r >= a.
+	/// @return bits shifted out of the high limb.
+	limb_t shiftLeft(limb_t* r, const limb_t* a, size_t n, unsigned s);
+
+	/// Shifts a to the right by 0 < s < LIMB_BITS bits.
+	/// Limbs are processed from the low one, so r may overlap a when r <= a.
+	/// @return bits shifted out of the low limb (in high bits of result).
+	limb_t shiftRight(limb_t* r, const limb_t* a, size_t n, unsigned s);
+
+	// Bitwise operations have no dependencies between limbs,
+	// so compilers vectorize their loops.
+
+	/// Computes r = a & b, all arrays have n limbs.
+	void andN(limb_t* r, const limb_t* a, const limb_t* b, size_t n);
+
+	/// Computes r = a & ~b, all arrays have n limbs.
+	void andNotN(limb_t* r, const limb_t* a, const limb_t* b, size_t n);
+
+	/// Computes r = a | b, all arrays have n limbs.
+	void iorN(limb_t* r, const limb_t* a, const limb_t* b, size_t n);
+
+	/// Computes r = a ^ b, all arrays have n limbs.
+	void xorN(limb_t* r, const limb_t* a, const limb_t* b, size_t n);
+
+	/// Divides a by one limb d, r may be the same array as a.
+	/// @return reminder.
+	limb_t divRem1(limb_t* r, const limb_t* a, size_t n, limb_t d);
+
+	/// Divides a by d with Knuth's algorithm D, where an >= dn >= 2 and d[dn - 1] != 0.
+	/// @param[out] q quotient with an - dn + 1 limbs.
+	/// @param[out] r reminder with dn limbs.
+	void divRemSchoolbook(limb_t* q, limb_t* r, const limb_t* a, size_t an, const limb_t* d, size_t dn);
+
+	/// Divides a by d with recursive Burnikel-Ziegler algorithm.
+	/// Requirements are the same as for divRemSchoolbook.
+	void divRemBZ(limb_t* q, limb_t* r, const limb_t* a, size_t an, const limb_t* d, size_t dn);
+
+	/// Divides a by d using reciprocal of d computed by Newton iteration.
+	/// Requirements are the same as for divRemSchoolbook.
+	void divRemNewton(limb_t* q, limb_t* r, const limb_t* a, size_t an, const limb_t* d, size_t dn);
+
+	/// Divides a by d choosing algorithm by operand sizes.
+	/// Requirements are the same as for divRemSchoolbook.
+	void divRem(limb_t* q, limb_t* r, const limb_t* a, size_t an, const limb_t* d, size_t dn);
+
+	/// Computes reciprocal of divisor d with n limbs and nonzero high limb for modBarrett.
+	/// @param[out] inv result with n + 1 limbs.
+	void barrettReciprocal(limb_t* inv, const limb_t* d, size_t n);
+
+	/// Computes r = a mod d by Barrett's method, where an >= n and d has n limbs
+	/// and nonzero high limb. Each n limbs of a cost two multiplications and no division.
+	/// @param inv reciprocal of d from barrettReciprocal.
+	/// @param[out] r reminder with n limbs.
+	void modBarrett(limb_t* r, const limb_t* a, size_t an, const limb_t* d, size_t n, const limb_t* inv);
+
+	/// Computes -m^-1 modulo 2^LIMB_BITS for odd m.
+	limb_t montInverse(limb_t m);
+
+	/// Montgomery reduction (REDC): computes r = t * 2^(-n * LIMB_BITS) mod m.
+	/// @param t number with 2n limbs, less than m * 2^(n * LIMB_BITS), it is destroyed.
+	/// @param m odd modulus with n limbs.
+	/// @param minv -m^-1 modulo 2^LIMB_BITS.
+	void redc(limb_t* r, limb_t* t, const limb_t* m, size_t n, limb_t minv);
+
+	/// Computes r = a^e mod m by sliding window exponentiation,
+	/// where m has n limbs and nonzero high limb, a < m has n limbs, e has en limbs.
+	/// Odd modulus is reduced by Montgomery multiplication, even one by division.
+	void powMod(limb_t* r, const limb_t* a, const limb_t* e, size_t en, const limb_t* m, size_t n);
+
+	/// Baillie-PSW test: strong probable prime test to base 2 and strong Lucas test
+	/// with P = 1 and Q = (1 - d) / 4. Both tests work in one Montgomery context.
+	/// @param m odd number greater than 2 with n limbs and nonzero high limb.
+	/// @param d Selfridge's parameter, Jacobi symbol (d / m) must be -1 and Q must be coprime with m.
+	/// @return false if m is composite, true if m is prime or a pseudoprime, none of which is known.
+	bool isProbablePrime(const limb_t* m, size_t n, int d);
+
+	///
+	/// \struct LehmerMatrix
+	/// \brief Absolute values of cofactors after several steps of Euclid's algorithm.
+	///
+	/// After even count of steps pair (a, b) goes to (s0 * a - t0 * b, t1 * b - s1 * a),
+	/// after odd count signs are opposite: (t0 * b - s0 * a, s1 * a - t1 * b).
+	///
+	struct LehmerMatrix
+	{
+		limb_t s0, t0, s1, t1;
+		bool odd;
+	};
+
+	/// Finds Euclid steps for a >= b by double-digit Lehmer simulation over two
+	/// high limbs of a and the same bits of b. Only steps, which are the same
+	/// for the whole numbers, are taken, so cofactors fit into one limb.
+	/// @param a number with n limbs and nonzero high limb.
+	/// @param b number with n limbs (may have high zero limbs).
+	/// @return false if no step can be found, then division step is needed.
+	bool lehmerMatrix(const limb_t* a, const limb_t* b, size_t n, LehmerMatrix& m);
+
+	/// Applies matrix from lehmerMatrix to a and b with n limbs in place.
+	/// @param tmp memory for 2n limbs.
+	void lehmerApply(limb_t* a, limb_t* b, size_t n, const LehmerMatrix& m, limb_t* tmp);
+
+	/// Computes greatest common divisor of two limbs.
+	limb_t gcd1(limb_t a, limb_t b);
+
+	/// Computes r = a * b with schoolbook algorithm.
+	/// r has an + bn limbs and doesn't overlap a or b.
+	void mulBasecase(limb_t* r, const limb_t* a, size_t an, const limb_t* b, size_t bn);
+
+	/// Computes r = a * b with Karatsuba algorithm, where an >= bn > (an + 1) / 2.
+	/// r has an + bn limbs and doesn't overlap a or b.
+	void mulKaratsuba(limb_t* r, const limb_t* a, size_t an, const limb_t* b, size_t bn);
+
+	/// Computes r = a * b with Toom-3 algorithm, where an >= bn > 2 * ((an + 2) / 3).
+	/// r has an + bn limbs and doesn't overlap a or b.
+	void mulToom3(limb_t* r, const limb_t* a, size_t an, const limb_t* b, size_t bn);
+
+	/// Checks if product of arrays with an and bn limbs
+	/// is not too long for number-theoretic transform.
+	bool nttFits(size_t an, size_t bn);
+
+	/// Computes r = a * b with three-prime number-theoretic transform
+	/// and Chinese remainder recombination, nttFits(an, bn) must be true.
+	/// r has an + bn limbs and doesn't overlap a or b.
+	void mulNTT(limb_t* r, const limb_t* a, size_t an, const limb_t* b, size_t bn);
+
+	/// Gives count of limbs, which is enough for number with len decimal digits.
+	size_t decimalLimbs(size_t len);
+
+	/// Converts string of len decimal digits (without sign) to limbs.
+	/// @param[out] r result with decimalLimbs(len) limbs.
+	/// @return count of significant limbs, zero for zero number.
+	size_t fromDecimal(limb_t* r, const char* s, size_t len);
+
+	/// Gives count of decimal digits, which is enough for number with n limbs.
+	size_t decimalDigits(size_t n);
+
+	/// Converts array of limbs to decimal digits without leading zeros.
+	/// @param[out] s result with decimalDigits(n) chars, zero gives "0".
+	/// @return count of written digits.
+	size_t toDecimal(char* s, const limb_t* a, size_t n);
+
+	/// Computes r = a * b choosing algorithm by operand sizes.
+	/// r has an + bn limbs and doesn't overlap a or b, an >= bn >= 1.
+	/// The same array for a and b is squared by sqr.
+	void mul(limb_t* r, const limb_t* a, size_t an, const limb_t* b, size_t bn);
+
+	/// Computes r = a^2 with schoolbook algorithm, each cross product is computed once.
+	/// r has 2n limbs and doesn't overlap a.
+	void sqrBasecase(limb_t* r, const limb_t* a, size_t n);
+
+	/// Computes r = a^2 with Karatsuba algorithm, n >= 2.
+	/// r has 2n limbs and doesn't overlap a.
+	void sqrKaratsuba(limb_t* r, const limb_t* a, size_t n);
+
+	/// Computes r = a^2 with Toom-3 algorithm, n >= 3.
+	/// r has 2n limbs and doesn't overlap a.
+	void sqrToom3(limb_t* r, const limb_t* a, size_t n);
+
+	/// Computes r = a^2 with number-theoretic transform, which is done once
+	/// instead of twice, nttFits(n, n) must be true.
+	/// r has 2n limbs and doesn't overlap a.
+	void sqrNTT(limb_t* r, const limb_t* a, size_t n);
+
+	/// Computes r = a^2 choosing algorithm by size, thresholds are the same as for mul.
+	/// r has 2n limbs and doesn't overlap a, n >= 1.
+	void sqr(limb_t* r, const limb_t* a, size_t n);
+}
@@ -0,0 +1,82 @@
+/**
+* @file ThreadPool.h
+* File with description of class ThreadPool
+*/
+
+#pragma once
+
+#include <vector>
+#include <deque>
+#include <functional>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+
+///
+/// \class ThreadPool
+/// \brief Shared workers for parallel branches of big number algorithms.
+///
+/// Calling thread takes part in the work, so with one thread
+/// no workers are started and all jobs run sequentially.
+/// While waiting for its jobs, a thread runs queued jobs of others,
+/// so nested parallel calls can't deadlock.
+///
+/// Only one object of this class can exist.
+///
+class ThreadPool
+{
+	/// \var workers
+	/// Started threads, one less than count of threads.
+	std::vector<std::thread> workers;
+
+	/// \var tasks
+	/// Jobs waiting for free thread.
+	std::deque<std::function<void()>> tasks;
+
+	/// \var mtx
+	/// Guards tasks, stopping and counters of running groups.
+	std::mutex mtx;
+
+	/// \var changed
+	/// Signals new task, finished task or stop.
+	std::condition_variable changed;
+
+	/// \var stopping
+	/// Workers leave their loop when it's true.
+	bool stopping = false;
+
+	/// The standard thread pool constructor, starts a thread per processor core.
+	ThreadPool();
+
+	~ThreadPool();
+
+	/// Starts workers, so there are n threads together with calling one.
+	/// @param n count of threads.
+	void start(size_t n);
+
+	/// Waits for workers to finish their current jobs and stops them.
+	void stop();
+
+	/// Loop of worker thread.
+	void workerLoop();
+
+public:
+	ThreadPool(const ThreadPool&) = delete;
+	ThreadPool& operator=(const ThreadPool&) = delete;
+
+	/// Create or get already existing instance of ThreadPool
+	/// @return thread pool instance
+	static ThreadPool& getInstance();
+
+	/// Changes count of threads. It mustn't be called while jobs are running.
+	/// @param n count of threads, 0 means count of processor cores.
+	void setThreads(size_t n);
+
+	/// @return count of threads together with calling one.
+	size_t threads() const { return workers.size() + 1; }
+
+	/// Runs jobs in parallel and waits until all of them are finished.
+	/// The first exception thrown by jobs is rethrown after that.
+	/// @param[in] jobs independent jobs.
+	void runAll(const std::vector<std::function<void()>>& jobs);
+};
@@ -0,0 +1,316 @@
+#include "../hdrs/Benchmark.h"
+#include "../hdrs/Kernels.h"
+#include "../hdrs/BigInt.h"
+#include "../hdrs/ThreadPool.h"
+
+#include <chrono>
+#include <random>
+#include <iostream>
+#include <iomanip>
+#include <sstream>
+#include <algorithm>
+
+std::vector<limb_t> Benchmark::randomLimbs(size_t n)
+{
+	static std::mt19937_64 gen(20220522);
+
+	std::vector<limb_t> res(n);
+	for (auto& x : res)
+		x = (limb_t)gen();
+
+	if (res.back() == 0)
+		res.back() = 1;
+
+	return res;
+}
+
+double Benchmark::measure(const std::function<void()>& func) const
+{
+	using clock = std::chrono::steady_clock;
+
+	size_t count = 0;
+	auto start = clock::now();
+	std::chrono::duration<double, std::micro> spent(0);
+
+	do
+	{
+		func();
+		count++;
+		spent = clock::now() - start;
+	} while (spent.count() < 100000);
+
+	return spent.count() / count;
+}
+
+void Benchmark::benchMultiplication()
+{
+	typedef void (*MulFunc)(limb_t*, const limb_t*, size_t, const limb_t*, size_t);
+
+	const char* names[] = { "schoolbook", "karatsuba", "toom-3", "ntt" };
+	MulFunc funcs[] = { limbs::mulBasecase, limbs::mulKaratsuba, limbs::mulToom3, limbs::mulNTT };
+	const size_t algs = 4;
+
+	// Algorithm isn't measured further when one call takes more than this time.
+	const double limit = 300000;
+
+	std::cout << pref << "Multiplication of n x n limbs, microseconds per call:" << std::endl;
+	std::cout << std::setw(10) << "n";
+	for (auto name : names)
+		std::cout << std::setw(14) << name;
+	std::cout << std::endl;
+
+	bool active[algs] = { true, true, true, true };
+	size_t crossover[algs] = { 0, 0, 0, 0 };
+
+	for (size_t n = 8; n <= ((size_t)1 << 18); n = n * 3 / 2 + (n * 3 / 2) % 2)
+	{
+		if (!limbs::nttFits(n, n))
+			break;
+
+		std::vector<limb_t> a = randomLimbs(n), b = randomLimbs(n), r(2 * n);
+		double times[algs];
+
+		std::cout << std::setw(10) << n;
+		for (size_t i = 0; i < algs; i++)
+		{
+			times[i] = -1;
+			if (active[i])
+			{
+				times[i] = measure([&]() { funcs[i](r.data(), a.data(), n, b.data(), n); });
+				active[i] = times[i] < limit;
+				std::cout << std::setw(14) << std::fixed << std::setprecision(1) << times[i];
+			}
+			else
+				std::cout << std::setw(14) << "-";
+		}
+		std::cout << std::endl;
+
+		for (size_t i = 1; i < algs; i++)
+			if (!crossover[i] && times[i] >= 0 && times[i - 1] >= 0 && times[i] < times[i - 1])
+				crossover[i] = n;
+	}
+
+	std::cout << pref << "Measured crossovers (current thresholds in brackets):" << std::endl;
+	std::cout << pref << "  karatsubaThreshold ~ " << crossover[1] << " [" << limbs::karatsubaThreshold << "]" << std::endl;
+	std::cout << pref << "  toom3Threshold     ~ " << crossover[2] << " [" << limbs::toom3Threshold << "]" << std::endl;
+	std::cout << pref << "  nttThreshold       ~ " << crossover[3] << " [" << limbs::nttThreshold << "]" << std::endl;
+}
+
+void Benchmark::benchParallel()
+{
+	size_t threads = ThreadPool::getInstance().threads();
+	std::cout << pref << "Multiplication of n x n limbs in one and " << threads << " threads, microseconds per call:" << std::endl;
+	std::cout << std::setw(10) << "n" << std::setw(14) << "sequential" << std::setw(14) << "parallel" << std::setw(14) << "speedup" << std::endl;
+
+	size_t oldParallel = limbs::parallelThreshold, crossover = 0;
+
+	for (size_t n = 64; n <= ((size_t)1 << 17); n *= 2)
+	{
+		std::vector<limb_t> a = randomLimbs(n), b = randomLimbs(n), r(2 * n);
+
+		limbs::parallelThreshold = SIZE_MAX;
+		double seqTime = measure([&]() { limbs::mul(r.data(), a.data(), n, b.data(), n); });
+		limbs::parallelThreshold = 1;
+		double parTime = measure([&]() { limbs::mul(r.data(), a.data(), n, b.data(), n); });
+
+		if (!crossover && parTime < seqTime)
+			crossover = n;
+
+		std::cout << std::setw(10) << n << std::fixed << std::setprecision(1)
+			<< std::setw(14) << seqTime << std::setw(14) << parTime
+			<< std::setw(13) << std::setprecision(2) << seqTime / parTime << "x" << std::endl;
+	}
+
+	limbs::parallelThreshold = oldParallel;
+
+	std::cout << pref << "Measured crossover (current threshold in brackets):" << std::endl;
+	std::cout << pref << "  parallelThreshold  ~ " << crossover << " [" << limbs::parallelThreshold << "]" << std::endl;
+}
+
+void Benchmark::benchSquaring()
+{
+	std::cout << pref << "Squaring against multiplication of equal n-limb numbers, microseconds per call:" << std::endl;
+	std::cout << std::setw(10) << "n" << std::setw(14) << "mul" << std::setw(14) << "sqr" << std::setw(14) << "speedup" << std::endl;
+
+	for (size_t n = 8; n <= ((size_t)1 << 15); n *= 2)
+	{
+		// a copy of the number, so mul doesn't see the same array
+		std::vector<limb_t> a = randomLimbs(n), b = a, r(2 * n);
+
+		double mulTime = measure([&]() { limbs::mul(r.data(), a.data(), n, b.data(), n); });
+		double sqrTime = measure([&]() { limbs::sqr(r.data(), a.data(), n); });
+
+		std::cout << std::setw(10) << n << std::fixed << std::setprecision(1)
+			<< std::setw(14) << mulTime << std::setw(14) << sqrTime
+			<< std::setw(13) << std::setprecision(2) << mulTime / sqrTime << "x" << std::endl;
+	}
+}
+
+void Benchmark::benchDivision()
+{
+	typedef void (*DivFunc)(limb_t*, limb_t*, const limb_t*, size_t, const limb_t*, size_t);
+
+	const char* names[] = { "schoolbook", "bz", "newton" };
+	DivFunc funcs[] = { limbs::divRemSchoolbook, limbs::divRemBZ, limbs::divRemNewton };
+	const size_t algs = 3;
+
+	const double limit = 300000;
+
+	std::cout << pref << "Division of 2n by n limbs, microseconds per call:" << std::endl;
+	std::cout << std::setw(10) << "n";
+	for (auto name : names)
+		std::cout << std::setw(14) << name;
+	std::cout << std::setw(14) << "barrett" << std::endl;
+
+	bool active[algs] = { true, true, true };
+	size_t crossover[algs] = { 0, 0, 0 };
+
+	// reduction by cached reciprocal is compared with the best division
+	bool barrettActive = true;
+	size_t barrettCrossover = 0;
+
+	for (size_t n = 8; n <= ((size_t)1 << 16); n = n * 3 / 2 + (n * 3 / 2) % 2)
+	{
+		std::vector<limb_t> a = randomLimbs(2 * n), d = randomLimbs(n), q(n + 1), r(n), inv(n + 1);
+		double times[algs];
+		double best = -1;
+
+		std::cout << std::setw(10) << n;
+		for (size_t i = 0; i < algs; i++)
+		{
+			times[i] = -1;
+			if (active[i])
+			{
+				times[i] = measure([&]() { funcs[i](q.data(), r.data(), a.data(), 2 * n, d.data(), n); });
+				active[i] = times[i] < limit;
+				best = best < 0 ? times[i] : std::min(best, times[i]);
+				std::cout << std::setw(14) << std::fixed << std::setprecision(1) << times[i];
+			}
+			else
+				std::cout << std::setw(14) << "-";
+		}
+
+		if (barrettActive)
+		{
+			limbs::barrettReciprocal(inv.data(), d.data(), n);
+			double time = measure([&]() { limbs::modBarrett(r.data(), a.data(), 2 * n, d.data(), n, inv.data()); });
+			barrettActive = time < limit;
+			if (!barrettCrossover && time < best)
+				barrettCrossover = n;
+			std::cout << std::setw(14) << std::fixed << std::setprecision(1) << time;
+		}
+		else
+			std::cout << std::setw(14) << "-";
+		std::cout << std::endl;
+
+		for (size_t i = 1; i < algs; i++)
+			if (!crossover[i] && times[i] >= 0 && times[i - 1] >= 0 && times[i] < times[i - 1])
+				crossover[i] = n;
+	}
+
+	std::cout << pref << "Measured crossovers (current thresholds in brackets):" << std::endl;
+	std::cout << pref << "  bzThreshold        ~ " << crossover[1] << " [" << limbs::bzThreshold << "]" << std::endl;
+	std::cout << pref << "  newtonThreshold    ~ " << crossover[2] << " [" << limbs::newtonThreshold << "]" << std::endl;
+	std::cout << pref << "  barrettThreshold   ~ " << barrettCrossover << " [" << limbs::barrettThreshold << "]" << std::endl;
+}
+
+void Benchmark::benchFactorial()
+{
+	std::cout << pref << "Factorial n!, milliseconds per call:" << std::endl;
+	std::cout << std::setw(10) << "n" << std::setw(14) << "chain" << std::setw(14) << "fact" << std::endl;
+
+	for (uint32_t n : { 10000, 100000, 1000000 })
+	{
+		BigInt res;
+
+		std::cout << std::setw(10) << n << std::fixed << std::setprecision(1);
+
+		// chain of n multiplications is quadratic, so it is measured only for smaller n
+		if (n <= 100000)
+		{
+			double chainTime = measure([&]()
+			{
+				res = BigInt(1u);
+				for (uint32_t i = 2; i <= n; i++)
+					res.mulLimbInPlace(i);
+			});
+			std::cout << std::setw(14) << chainTime / 1000;
+		}
+		else
+			std::cout << std::setw(14) << "-";
+
+		double factTime = measure([&]() { BigInt::factorialInto(res, BigInt(n)); });
+		std::cout << std::setw(14) << factTime / 1000 << std::endl;
+	}
+}
+
+void Benchmark::benchKernels()
+{
+	using kernels::Isa;
+
+	const Isa isas[] = { Isa::scalar, Isa::avx2, Isa::avx512 };
+	const char* names[] = { "cmp", "addN", "subN", "addMul1" };
+
+	std::cout << pref << "Kernels on n limbs, nanoseconds per call (speedup over scalar), active: "
+		<< kernels::active().name << std::endl;
+	std::cout << std::setw(10) << "kernel" << std::setw(8) << "n";
+	for (Isa isa : isas)
+		std::cout << std::setw(18) << (kernels::get(isa) ? kernels::get(isa)->name : "-");
+	std::cout << std::endl;
+
+	for (size_t k = 0; k < 4; k++)
+	{
+		for (size_t n : { 16, 256, 4096 })
+		{
+			// equal arrays make comparison go through all limbs
+			std::vector<limb_t> a = randomLimbs(n), b = k == 0 ? a : randomLimbs(n), r(n);
+			double scalar = 0;
+
+			std::cout << std::setw(10) << names[k] << std::setw(8) << n;
+			for (Isa isa : isas)
+			{
+				const kernels::Table* t = kernels::get(isa);
+				if (!t)
+				{
+					std::cout << std::setw(18) << "-";
+					continue;
+				}
+
+				std::function<void()> funcs[] =
+				{
+					[&]() { t->cmp(a.data(), b.data(), n); },
+					[&]() { t->addN(r.data(), a.data(), b.data(), n); },
+					[&]() { t->subN(r.data(), a.data(), b.data(), n); },
+					[&]() { t->addMul1(r.data(), a.data(), n, b[0]); }
+				};
+
+				double time = measure(funcs[k]) * 1000;
+				if (isa == Isa::scalar)
+					scalar = time;
+
+				std::ostringstream cell;
+				cell << std::fixed << std::setprecision(1) << time << " (" << std::setprecision(2) << scalar / time << "x)";
+				std::cout << std::setw(18) << cell.str();
+			}
+			std::cout << std::endl;
+		}
+	}
+}
+
+Benchmark& Benchmark::getInstance()
+{
+	static Benchmark bench;
+	return bench;
+}
+
+void Benchmark::benchProgram()
+{
+	benchKernels();
+	benchMultiplication();
+	benchParallel();
+	benchSquaring();
+	benchDivision();
+	benchFactorial();
+
+	std::cout << pref << "Benchmark finished." << std::endl;
+}
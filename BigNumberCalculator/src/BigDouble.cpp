@@ -1,5 +1,7 @@
 #include "../hdrs/BigDouble.h"
 
+#include <algorithm>
+#include <cstdlib>
 #include <stdexcept>
 
 void BigDouble::stringToNum(const std::string& st)
@@ -20,11 +22,8 @@ void BigDouble::stringToNum(const std::string& st)
 
 void BigDouble::cutExcessZeros()
 {
-	for(std::pair<BigInt, BigInt> tmp; (tmp = intPart.divide(10)).second.isZero() && commaPoint > 0;)
-	{
-		intPart = tmp.first;
-		commaPoint--;
-	}
+	if (commaPoint > 0)
+		commaPoint -= intPart.stripPow10(commaPoint);
 }
 
 BigDouble::BigDouble(std::string num)
@@ -34,13 +33,6 @@ BigDouble::BigDouble(std::string num)
 	stringToNum(num);
 }
 
-BigDouble::BigDouble(const BigDouble& num)
-	:
-	commaPoint(0)
-{
-	stringToNum(num.toString(true));
-}
-
 std::string BigDouble::toString(bool zeroMinus) const
 {
 	std::string res = intPart.toString();
@@ -55,48 +47,143 @@ std::string BigDouble::toString(bool zeroMinus) const
 	return res;
 }
 
-BigDouble BigDouble::addBigDouble(BigDouble num2) const
+void BigDouble::addInto(BigDouble& res, const BigInt& intB, size_t commaB, bool negate) const
 {
-	BigDouble res(*this);
+	// operand with shorter fractional part is aligned in res,
+	// so sum is computed in place and keeps order of operands
+	if (commaPoint < commaB)
+	{
+		BigInt::mulPow10Into(res.intPart, intPart, commaB - commaPoint);
+		negate ? BigInt::subInto(res.intPart, res.intPart, intB) : BigInt::addInto(res.intPart, res.intPart, intB);
+	}
+	else if (commaB < commaPoint)
+	{
+		BigInt::mulPow10Into(res.intPart, intB, commaPoint - commaB);
+		negate ? BigInt::subInto(res.intPart, intPart, res.intPart) : BigInt::addInto(res.intPart, intPart, res.intPart);
+	}
+	else
+		negate ? BigInt::subInto(res.intPart, intPart, intB) : BigInt::addInto(res.intPart, intPart, intB);
 
-	size_t cP = std::max(res.commaPoint, num2.commaPoint);
+	res.commaPoint = std::max(commaPoint, commaB);
+	res.cutExcessZeros();
+}
+
+void BigDouble::mulInto(BigDouble& res, const BigInt& intB, size_t commaB) const
+{
+	BigInt::mulInto(res.intPart, intPart, intB);
+	res.commaPoint = commaPoint + commaB;
 
-	for (size_t it = res.commaPoint; it < cP; it++)
+	res.cutExcessZeros();
+}
+
+void BigDouble::divInto(BigDouble& res, const BigInt& intB, size_t commaB, size_t precision) const
+{
+	// a / b = (intA / intB) * 10^(commaB - commaA), so quotient with precision
+	// fractional digits is intA * 10^(precision + commaB - commaA) / intB,
+	// only one operand is scaled and division is done by big integers
+	const BigInt* num = &intPart;
+	const BigInt* den = &intB;
+	BigInt scaled, rem;
+
+	size_t up = precision + commaB;
+	if (up > commaPoint)
 	{
-		res.intPart = res.intPart.multiplyBigInt(10);
+		BigInt::mulPow10Into(scaled, intPart, up - commaPoint);
+		num = &scaled;
 	}
-	
-	for (size_t it = num2.commaPoint; it < cP; it++)
+	else if (up < commaPoint)
 	{
-		num2.intPart = num2.intPart.multiplyBigInt(10);
+		BigInt::mulPow10Into(scaled, intB, commaPoint - up);
+		den = &scaled;
 	}
 
-	res.intPart = res.intPart.addBigInt(num2.intPart);
-	res.commaPoint = cP;
+	BigInt::divmodInto(res.intPart, rem, *num, *den);
+
+	// integer quotient is rounded down, digits are cut off towards zero
+	if (!rem.isZero() && intPart.checkMinus() != intB.checkMinus())
+		BigInt::addInto(res.intPart, res.intPart, BigInt(1u));
+
+	res.commaPoint = precision;
+	res.cutExcessZeros();
+}
+
+void BigDouble::modInto(BigDouble& res, const BigInt& intB, size_t commaB) const
+{
+	// both operands are aligned to the longer fractional part
+	BigInt scaled, quot;
+
+	if (commaPoint < commaB)
+	{
+		BigInt::mulPow10Into(scaled, intPart, commaB - commaPoint);
+		BigInt::divmodInto(quot, res.intPart, scaled, intB);
+	}
+	else if (commaB < commaPoint)
+	{
+		BigInt::mulPow10Into(scaled, intB, commaPoint - commaB);
+		BigInt::divmodInto(quot, res.intPart, intPart, scaled);
+	}
+	else
+		BigInt::divmodInto(quot, res.intPart, intPart, intB);
 
+	res.commaPoint = std::max(commaPoint, commaB);
 	res.cutExcessZeros();
+}
+
+const BigInt& BigDouble::splitNum(const IBigNum_ptr& num, size_t& comma)
+{
+	if (BigDouble* kk = dynamic_cast<BigDouble*>(num.get()))
+	{
+		comma = kk->commaPoint;
+		return kk->intPart;
+	}
+
+	comma = 0;
+	return *dynamic_cast<BigInt*>(num.get());
+}
+
+IBigNum_ptr BigDouble::toBigNum(BigDouble& res)
+{
+	if (!res.commaPoint)
+		return std::make_shared<BigInt>(std::move(res.intPart));
+	else
+		return std::make_shared<BigDouble>(std::move(res));
+}
+
+BigDouble BigDouble::addBigDouble(const BigDouble& num2) const
+{
+	BigDouble res;
+	addInto(res, num2.intPart, num2.commaPoint, false);
 
 	return res;
 }
 
 BigDouble BigDouble::subBigDouble(const BigDouble& num2) const
 {
-	BigDouble t = num2;
-	t.intPart.timesMinusOne();
-	return addBigDouble(t);
+	BigDouble res;
+	addInto(res, num2.intPart, num2.commaPoint, true);
+
+	return res;
 }
 
 BigDouble BigDouble::multiplyBigDouble(const BigDouble& num2) const
 {
-	BigDouble res(*this);
-	res.intPart = res.intPart.multiplyBigInt(num2.intPart);
-	res.commaPoint += num2.commaPoint;
-
-	res.cutExcessZeros();
+	BigDouble res;
+	mulInto(res, num2.intPart, num2.commaPoint);
 
 	return res;
 }
 
+IBigNum_ptr BigDouble::divide(const IBigNum_ptr& num2, size_t precision) const
+{
+	size_t commaB;
+	const BigInt& intB = splitNum(num2, commaB);
+
+	BigDouble res;
+	divInto(res, intB, commaB, precision);
+
+	return toBigNum(res);
+}
+
 IBigNum_ptr BigDouble::clone() const
 {
 	return IBigNum_ptr(new BigDouble(*this));
@@ -105,82 +192,139 @@ IBigNum_ptr BigDouble::clone() const
 
 IBigNum_ptr BigDouble::operator+(const IBigNum_ptr& num2) const
 {
+	BigDouble res;
+
 	if (BigDouble* kk = dynamic_cast<BigDouble*>(num2.get()))
 	{
-		BigDouble k = addBigDouble(*kk);
-		if (!k.commaPoint)
-			return IBigNum_ptr(new BigInt(k.intPart));
-		else
-			return IBigNum_ptr(new BigDouble(k));
+		addInto(res, kk->intPart, kk->commaPoint, false);
+		return toBigNum(res);
 	}
 	else
 	{
 		BigInt* kk2 = dynamic_cast<BigInt*>(num2.get());
-		BigDouble t("0");
-		t.intPart = *kk2;
-		
-		return IBigNum_ptr(new BigDouble(addBigDouble(t)));
+		addInto(res, *kk2, 0, false);
+
+		return std::make_shared<BigDouble>(std::move(res));
 	}
 }
 
 IBigNum_ptr BigDouble::operator+(long num2) const
 {
-	BigDouble t("0");
-	t.intPart = num2;
+	BigInt t((uint32_t)std::labs(num2));
+	if (num2 < 0)
+		t.timesMinusOne();
+
+	BigDouble res;
+	addInto(res, t, 0, false);
 
-	return IBigNum_ptr(new BigDouble(addBigDouble(t)));
+	return std::make_shared<BigDouble>(std::move(res));
 }
 
 IBigNum_ptr BigDouble::operator-(const IBigNum_ptr& num2) const
 {
+	BigDouble res;
+
 	if (BigDouble* kk = dynamic_cast<BigDouble*>(num2.get()))
 	{
-		BigDouble k = subBigDouble(*kk);
-		if (!k.commaPoint)
-			return IBigNum_ptr(new BigInt(k.intPart));
-		else
-			return IBigNum_ptr(new BigDouble(k));
+		addInto(res, kk->intPart, kk->commaPoint, true);
+		return toBigNum(res);
 	}
 	else
 	{
 		BigInt* kk2 = dynamic_cast<BigInt*>(num2.get());
-		BigDouble t("0");
-		t.intPart = *kk2;
-		t.intPart.timesMinusOne();
+		addInto(res, *kk2, 0, true);
 
-		return IBigNum_ptr(new BigDouble(addBigDouble(t)));
+		return std::make_shared<BigDouble>(std::move(res));
 	}
 }
 
 IBigNum_ptr BigDouble::operator*(const IBigNum_ptr& num2) const
 {
+	BigDouble res;
+
 	if (BigDouble* kk = dynamic_cast<BigDouble*>(num2.get()))
 	{
-		return IBigNum_ptr(new BigDouble(multiplyBigDouble(*kk)));
+		mulInto(res, kk->intPart, kk->commaPoint);
+		return toBigNum(res);
 	}
 	else
 	{
 		BigInt* kk2 = dynamic_cast<BigInt*>(num2.get());
-		BigDouble t("0");
-		t.intPart = *kk2;
-
-		BigDouble k = multiplyBigDouble(t);
-		if (!k.commaPoint)
-			return IBigNum_ptr(new BigInt(k.intPart));
-		else
-			return IBigNum_ptr(new BigDouble(k));
+		mulInto(res, *kk2, 0);
+
+		return toBigNum(res);
 	}
 }
 
 IBigNum_ptr BigDouble::operator/(const IBigNum_ptr& num2) const
 {
-	throw std::runtime_error("Division is not defined for BigDouble!!!");
-	return IBigNum_ptr();
+	return divide(num2, DEFAULT_PRECISION);
 }
 
 IBigNum_ptr BigDouble::operator%(const IBigNum_ptr& num2) const
 {
-	throw std::runtime_error("Mod is not defined for BigDouble!!!");
+	size_t commaB;
+	const BigInt& intB = splitNum(num2, commaB);
+
+	BigDouble res;
+	modInto(res, intB, commaB);
+
+	return toBigNum(res);
+}
+
+IBigNum_ptr BigDouble::power(const IBigNum_ptr& num2) const
+{
+	BigInt* kk = dynamic_cast<BigInt*>(num2.get());
+	if (!kk)
+		throw std::runtime_error("Exponent must be integer!!!");
+
+	bool unitBase = intPart.isZero() || (!commaPoint && intPart.isAbsEqual(BigInt(1u)));
+	uint64_t exp = kk->toExponent(unitBase);
+	if (commaPoint && exp > SIZE_MAX / commaPoint)
+		throw std::runtime_error("Too big exponent!!!");
+
+	// (m * 10^-c)^e = m^e * 10^-(c * e)
+	BigDouble res;
+	BigInt::powInto(res.intPart, intPart, exp);
+	res.commaPoint = commaPoint * (size_t)exp;
+	res.cutExcessZeros();
+
+	return toBigNum(res);
+}
+
+IBigNum_ptr BigDouble::operator<<(const IBigNum_ptr& num2) const
+{
+	throw std::runtime_error("Shift is not defined for BigDouble!!!");
+	return IBigNum_ptr();
+}
+
+IBigNum_ptr BigDouble::operator>>(const IBigNum_ptr& num2) const
+{
+	throw std::runtime_error("Shift is not defined for BigDouble!!!");
+	return IBigNum_ptr();
+}
+
+IBigNum_ptr BigDouble::operator&(const IBigNum_ptr& num2) const
+{
+	throw std::runtime_error("Bitwise operations are not defined for BigDouble!!!");
+	return IBigNum_ptr();
+}
+
+IBigNum_ptr BigDouble::operator|(const IBigNum_ptr& num2) const
+{
+	throw std::runtime_error("Bitwise operations are not defined for BigDouble!!!");
+	return IBigNum_ptr();
+}
+
+IBigNum_ptr BigDouble::operator^(const IBigNum_ptr& num2) const
+{
+	throw std::runtime_error("Bitwise operations are not defined for BigDouble!!!");
+	return IBigNum_ptr();
+}
+
+IBigNum_ptr BigDouble::operator~() const
+{
+	throw std::runtime_error("Bitwise operations are not defined for BigDouble!!!");
 	return IBigNum_ptr();
 }
 
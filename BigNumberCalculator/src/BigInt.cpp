@@ -1,17 +1,21 @@
 #include "../hdrs/BigInt.h"
 #include "../hdrs/BigDouble.h"
+#include "../hdrs/Limbs.h"
 
 #include <limits.h>
-#include <bitset>
 #include <algorithm>
+#include <cstring>
 #include <stdexcept>
+#include <vector>
+#include <deque>
+#include <map>
+#include <mutex>
 
 #include <iostream>
 
 void BigInt::stringToNum(const std::string& st)
 {
 	size_t start = 0;
-	bigNum.clear();
 
 	if (st[0] == '-')
 	{
@@ -21,188 +25,1456 @@ void BigInt::stringToNum(const std::string& st)
 	else
 		isMinus = false;
 
-	/// Convert decimal number string to binary number string
-	std::string tmp = st.substr(start);
-	std::string binNum;
+	// convert decimal digits to limbs, leading zeros give no limbs
+	bigNum.assign(limbs::decimalLimbs(st.size() - start), 0);
+	bigNum.resize(limbs::fromDecimal(bigNum.data(), st.data() + start, st.size() - start));
 
-	while (tmp.compare("0") != 0 || binNum.size() % 32)
+	if (bigNum.empty())
+		bigNum.push_back(0);
+}
+
+void BigInt::trim()
+{
+	while (bigNum.size() > 1 && bigNum.back() == 0)
+		bigNum.pop_back();
+}
+
+void BigInt::divmodInto(BigInt& q, BigInt& r, const BigInt& a, const BigInt& b)
+{
+	if (b.isZero())
+		throw std::runtime_error("Division by zero!!!");
+
+	// results overwriting operands are computed in temporary numbers
+	if (&q == &a || &q == &b || &r == &a || &r == &b)
+	{
+		BigInt res, rem;
+		divmodInto(res, rem, a, b);
+		q = std::move(res);
+		r = std::move(rem);
+		return;
+	}
+
+	bool finalSign = a.isMinus != b.isMinus;
+
+	if (a.absLessThan(b))
+	{
+		q.bigNum.assign(1, 0);
+		r.bigNum = a.bigNum;
+	}
+	else if (b.bigNum.size() == 1)
+	{
+		q.bigNum.resize(a.bigNum.size());
+		r.bigNum.assign(1, limbs::divRem1(q.bigNum.data(), a.bigNum.data(), a.bigNum.size(), b.bigNum[0]));
+		q.trim();
+	}
+	else
+	{
+		size_t an = a.bigNum.size(), dn = b.bigNum.size();
+
+		q.bigNum.resize(an - dn + 1);
+		r.bigNum.resize(dn);
+		limbs::divRem(q.bigNum.data(), r.bigNum.data(), a.bigNum.data(), an, b.bigNum.data(), dn);
+
+		q.trim();
+		r.trim();
+	}
+
+	q.isMinus = finalSign;
+	r.isMinus = a.isMinus;
+
+	// floor division: for different signs quotient is rounded down
+	// and reminder gets the sign of divisor
+	if (finalSign && !r.isZero())
+	{
+		q.isMinus = false;
+		q.addInPlace(BigInt(1u));
+		q.isMinus = true;
+
+		// r = b - sign(b) * |r|
+		r.isMinus = !b.isMinus;
+		addInto(r, r, b, false);
+	}
+}
+
+void BigInt::barrettReciprocalInto(BigInt& inv, const BigInt& m)
+{
+	if (m.isZero())
+		throw std::runtime_error("Division by zero!!!");
+
+	// short modulus is reduced by division, reciprocal is left zero
+	size_t n = m.bigNum.size();
+	if (n < limbs::barrettThreshold)
+	{
+		inv = BigInt();
+		return;
+	}
+
+	inv.bigNum.resize(n + 1);
+	limbs::barrettReciprocal(inv.bigNum.data(), m.bigNum.data(), n);
+	inv.isMinus = false;
+	inv.trim();
+}
+
+void BigInt::modBarrettInto(BigInt& dst, const BigInt& a, const BigInt& m, const BigInt& inv)
+{
+	if (inv.isZero() || a.absLessThan(m))
+	{
+		BigInt q;
+		divmodInto(q, dst, a, m);
+		return;
+	}
+
+	size_t n = m.bigNum.size();
+	LimbVector r(n);
+	limbs::modBarrett(r.data(), a.bigNum.data(), a.bigNum.size(), m.bigNum.data(), n, inv.bigNum.data());
+
+	bool aMinus = a.isMinus;
+	dst.bigNum = std::move(r);
+	dst.isMinus = aMinus;
+	dst.trim();
+
+	// the same rounding down as in divmodInto
+	if (aMinus != m.isMinus && !dst.isZero())
+	{
+		dst.isMinus = !m.isMinus;
+		addInto(dst, dst, m, false);
+	}
+}
+
+BigInt BigInt::powerBigInt(const BigInt& num2) const
+{
+	BigInt res;
+	powInto(res, *this, num2.toExponent(bigNum.size() == 1 && bigNum[0] <= 1));
+	return res;
+}
+
+std::pair<BigInt, BigInt> BigInt::divide(const BigInt& num) const
+{
+	std::pair<BigInt, BigInt> res;
+	divmodInto(res.first, res.second, *this, num);
+
+	return res;
+}
+
+void BigInt::mulSubInto(BigInt& dst, const BigInt& x, limb_t p, const BigInt& y, limb_t q)
+{
+	BigInt xp = x, yq = y;
+	xp.mulLimbInPlace(p);
+	yq.mulLimbInPlace(q);
+
+	subInto(dst, xp, yq);
+}
+
+void BigInt::applyMatrix(const BigInt (&m)[4], BigInt& x, BigInt& y)
+{
+	BigInt t1, t2, t3, t4;
+	mulInto(t1, m[0], x);
+	mulInto(t2, m[2], y);
+	mulInto(t3, m[1], x);
+	mulInto(t4, m[3], y);
+
+	addInto(x, t1, t2);
+	addInto(y, t3, t4);
+}
+
+void BigInt::euclidStep(BigInt& a, BigInt& b, BigInt* pairs, size_t count, bool lehmer)
+{
+	if (lehmer)
+	{
+		size_t n = a.bigNum.size();
+		limbs::LehmerMatrix lm;
+
+		b.bigNum.resize(n);
+		bool found = limbs::lehmerMatrix(a.bigNum.data(), b.bigNum.data(), n, lm);
+		if (found)
+		{
+			LimbVector tmp(2 * n);
+			limbs::lehmerApply(a.bigNum.data(), b.bigNum.data(), n, lm, tmp.data());
+		}
+
+		a.trim();
+		b.trim();
+
+		if (found)
+		{
+			for (size_t i = 0; i < count; i++)
+			{
+				BigInt& x = pairs[2 * i];
+				BigInt& y = pairs[2 * i + 1];
+				BigInt nx, ny;
+
+				if (lm.odd)
+				{
+					mulSubInto(nx, y, lm.t0, x, lm.s0);
+					mulSubInto(ny, x, lm.s1, y, lm.t1);
+				}
+				else
+				{
+					mulSubInto(nx, x, lm.s0, y, lm.t0);
+					mulSubInto(ny, y, lm.t1, x, lm.s1);
+				}
+
+				x = std::move(nx);
+				y = std::move(ny);
+			}
+
+			return;
+		}
+	}
+
+	// (a, b) goes to (b, a - q * b)
+	BigInt q, r;
+	divmodInto(q, r, a, b);
+	a = std::move(b);
+	b = std::move(r);
+
+	for (size_t i = 0; i < count; i++)
+	{
+		BigInt& x = pairs[2 * i];
+		BigInt& y = pairs[2 * i + 1];
+		BigInt t;
+
+		mulInto(t, q, y);
+		subInto(x, x, t);
+		std::swap(x, y);
+	}
+}
+
+bool BigInt::hgcd(BigInt& a, BigInt& b, BigInt (&m)[4])
+{
+	m[0] = BigInt(1u);
+	m[1] = BigInt();
+	m[2] = BigInt();
+	m[3] = BigInt(1u);
+
+	size_t n = a.bigNum.size(), s = n / 2 + 1;
+	if (b.bigNum.size() <= s)
+		return false;
+
+	if (n >= limbs::hgcdThreshold)
+	{
+		// high half of limbs gives reduction to about 3n / 4 limbs
+		hgcdHigh(a, b, m, n / 2);
+
+		while (a.bigNum.size() > 3 * n / 4 + 1 && b.bigNum.size() > s)
+			euclidStep(a, b, m, 2, true);
+
+		// high limbs of the rest give reduction to about n / 2 limbs
+		size_t k = a.bigNum.size();
+		if (b.bigNum.size() > s && k > s + 2)
+		{
+			BigInt m2[4];
+			hgcdHigh(a, b, m2, 2 * s - k + 1);
+			applyMatrix(m2, m[0], m[1]);
+			applyMatrix(m2, m[2], m[3]);
+		}
+	}
+
+	// Lehmer steps stop a limb before the bound, so they can't go much below it
+	while (b.bigNum.size() > s)
+		euclidStep(a, b, m, 2, b.bigNum.size() > s + 1);
+
+	return true;
+}
+
+bool BigInt::hgcdHigh(BigInt& a, BigInt& b, BigInt (&m)[4], size_t p)
+{
+	BigInt x, y;
+	x.bigNum.assign(a.bigNum.size() - p, 0);
+	std::copy(a.bigNum.begin() + p, a.bigNum.end(), x.bigNum.begin());
+	y.bigNum.assign(b.bigNum.size() - p, 0);
+	std::copy(b.bigNum.begin() + p, b.bigNum.end(), y.bigNum.begin());
+	y.trim();
+
+	if (!hgcd(x, y, m))
+		return false;
+
+	// m * (a, b) = (x, y) * 2^(p * LIMB_BITS) + m * (low limbs of a and b),
+	// so only low limbs are multiplied by the matrix
+	a.bigNum.resize(p);
+	b.bigNum.resize(p);
+	a.trim();
+	b.trim();
+	applyMatrix(m, a, b);
+
+	x.shiftLeft(p * LIMB_BITS);
+	y.shiftLeft(p * LIMB_BITS);
+	addInto(a, a, x);
+	addInto(b, b, y);
+
+	// any matrix with determinant 1 or -1 keeps gcd, so wrong last steps
+	// only need rows of the matrix to be negated or swapped
+	if (a.isMinus)
+	{
+		a.isMinus = false;
+		m[0].timesMinusOne();
+		m[2].timesMinusOne();
+	}
+
+	if (b.isMinus)
+	{
+		b.isMinus = false;
+		m[1].timesMinusOne();
+		m[3].timesMinusOne();
+	}
+
+	if (a.absLessThan(b))
+	{
+		std::swap(a, b);
+		std::swap(m[0], m[1]);
+		std::swap(m[2], m[3]);
+	}
+
+	return true;
+}
+
+void BigInt::gcdReduce(BigInt& a, BigInt& b, BigInt* u)
+{
+	while (!b.isZero())
+	{
+		// half-GCD of high 2/3 of limbs reduces numbers by 1/3 of limbs
+		size_t p = a.bigNum.size() / 3;
+		if (b.bigNum.size() >= limbs::hgcdThreshold && b.bigNum.size() > p)
+		{
+			BigInt m[4];
+			if (hgcdHigh(a, b, m, p))
+			{
+				if (u)
+					applyMatrix(m, u[0], u[1]);
+				continue;
+			}
+		}
+		else if (!u && b.bigNum.size() == 1)
+		{
+			limb_t g = limbs::gcd1(b.bigNum[0], a.modLimb(b.bigNum[0]));
+			a.bigNum.assign(1, g);
+			b.bigNum.assign(1, 0);
+			break;
+		}
+
+		euclidStep(a, b, u, u ? 1 : 0, true);
+	}
+}
+
+void BigInt::gcdInto(BigInt& dst, const BigInt& a, const BigInt& b)
+{
+	BigInt x = a, y = b;
+	x.isMinus = y.isMinus = false;
+
+	if (x.absLessThan(y))
+		std::swap(x, y);
+
+	gcdReduce(x, y, nullptr);
+	dst = std::move(x);
+}
+
+void BigInt::gcdExtInto(BigInt& g, BigInt& s, const BigInt& a, const BigInt& b)
+{
+	BigInt x = a, y = b;
+	x.isMinus = y.isMinus = false;
+
+	// cofactors of |a| for x and y
+	BigInt u[2] = { BigInt(1u), BigInt() };
+	if (x.absLessThan(y))
+	{
+		std::swap(x, y);
+		std::swap(u[0], u[1]);
+	}
+
+	gcdReduce(x, y, u);
+
+	if (a.isMinus)
+		u[0].timesMinusOne();
+
+	// cofactors differ by multiples of b / g
+	if (!b.isZero())
+	{
+		BigInt bound, rem, absB = b;
+		absB.isMinus = false;
+		divmodInto(bound, rem, absB, x);
+		divmodInto(rem, u[0], u[0], bound);
+	}
+
+	g = std::move(x);
+	s = std::move(u[0]);
+}
+
+void BigInt::lcmInto(BigInt& dst, const BigInt& a, const BigInt& b)
+{
+	BigInt g;
+	gcdInto(g, a, b);
+
+	if (g.isZero())
+	{
+		dst = BigInt();
+		return;
+	}
+
+	BigInt x = a, y = b, rem;
+	x.isMinus = y.isMinus = false;
+	divmodInto(x, rem, x, g);
+	mulInto(dst, x, y);
+}
+
+void BigInt::modInvInto(BigInt& dst, const BigInt& a, const BigInt& m)
+{
+	if (m.isZero())
+		throw std::runtime_error("Division by zero!!!");
+
+	BigInt g, s;
+	gcdExtInto(g, s, a, m);
+
+	if (g.bigNum.size() != 1 || g.bigNum[0] != 1)
+		throw std::runtime_error("Modular inverse doesn't exist!!!");
+
+	// s is in [0, |m|), reminder for negative m is in (m, 0]
+	if (m.isMinus && !s.isZero())
+		addInto(s, s, m);
+
+	dst = std::move(s);
+}
+
+void BigInt::rootAbs(BigInt& dst, const BigInt& n, size_t k)
+{
+	if (k == 1)
+	{
+		dst = n;
+		return;
+	}
+
+	size_t rootBits = (n.bitLength() + k - 1) / k;
+	size_t kBits = 0;
+	for (size_t t = k; t; t >>= 1)
+		kBits++;
+
+	BigInt x, t;
+
+	// the root is less than 2^rootBits
+	if (rootBits <= 2 * LIMB_BITS + kBits + 2)
+	{
+		// short root is found bit by bit from the high one
+		for (size_t i = rootBits; i-- > 0;)
+		{
+			BigInt y(1u);
+			y.shiftLeft(i);
+			addInto(y, y, x);
+
+			powInto(t, y, k);
+			if (!n.absLessThan(t))
+				x = std::move(y);
+		}
+
+		dst = std::move(x);
+		return;
+	}
+
+	// if r = root of n / 2^(k * h), root of n is in [r * 2^h, (r + 1) * 2^h),
+	// h is chosen so that Newton step from the upper bound is less than 1/2 away from the root
+	size_t h = (rootBits - kBits - 2) / 2;
+
+	BigInt high = n;
+	high.shiftRight(k * h);
+	rootAbs(x, high, k);
+	x.addInPlace(BigInt(1u));
+	x.shiftLeft(h);
+
+	// x = ((k - 1) * x + n / x^(k - 1)) / k, it is not less than the root
+	BigInt q, r;
+	powInto(t, x, k - 1);
+	divmodInto(q, r, n, t);
+	x.mulLimbInPlace((limb_t)(k - 1));
+	addInto(x, x, q);
+	x.divLimbInPlace((limb_t)k);
+
+	// x may be greater than the root only by rounding
+	powInto(t, x, k);
+	while (n.absLessThan(t))
+	{
+		subInto(x, x, BigInt(1u));
+		powInto(t, x, k);
+	}
+
+	dst = std::move(x);
+}
+
+void BigInt::sqrtInto(BigInt& dst, const BigInt& n)
+{
+	rootInto(dst, n, BigInt(2u));
+}
+
+void BigInt::rootInto(BigInt& dst, const BigInt& n, const BigInt& k)
+{
+	if (k.isZero() || k.isMinus)
+		throw std::runtime_error("Root degree must be positive!!!");
+
+	bool negative = n.isMinus && !n.isZero();
+	if (negative && !(k.bigNum[0] & 1))
+		throw std::runtime_error("Even root of negative number!!!");
+
+	// 2^k > |n| gives root 1 or 0
+	size_t bits = n.bitLength();
+	if (k.bigNum.size() > 1 || k.bigNum[0] >= bits)
+	{
+		dst = BigInt(bits ? 1u : 0u);
+	}
+	else
+	{
+		BigInt absN = n;
+		absN.isMinus = false;
+		rootAbs(dst, absN, (size_t)k.bigNum[0]);
+	}
+
+	dst.isMinus = negative;
+}
+
+namespace
+{
+	/// Finds primes up to n by sieve of Eratosthenes over odd numbers.
+	std::vector<uint32_t> primesUpTo(uint32_t n)
 	{
-		char rem = 0;
+		std::vector<uint32_t> primes;
+		if (n < 2)
+			return primes;
+
+		primes.push_back(2);
+
+		// composite[i] is for number 2i + 1
+		std::vector<bool> composite(n / 2 + 1);
+		for (uint64_t i = 1; 2 * i + 1 <= n; i++)
+		{
+			if (composite[i])
+				continue;
+
+			uint64_t p = 2 * i + 1;
+			primes.push_back((uint32_t)p);
+
+			for (uint64_t j = p * p / 2; 2 * j + 1 <= n; j += p)
+				composite[j] = true;
+		}
+
+		return primes;
+	}
+
+	/// Computes exponent of prime p in n! by Legendre's formula.
+	uint64_t factorialExponent(uint64_t n, uint64_t p)
+	{
+		uint64_t e = 0;
+		while (n)
+		{
+			n /= p;
+			e += n;
+		}
+
+		return e;
+	}
+
+	/// Writes product of limbs [from, to) to dst by balanced tree,
+	/// so big multiplications have operands of similar length.
+	void productInto(BigInt& dst, const std::vector<limb_t>& f, size_t from, size_t to)
+	{
+		if (to - from <= 16)
+		{
+			dst = BigInt(1u);
+			for (size_t i = from; i < to; i++)
+				dst.mulLimbInPlace(f[i]);
+			return;
+		}
+
+		size_t mid = from + (to - from) / 2;
+		BigInt left, right;
+		productInto(left, f, from, mid);
+		productInto(right, f, mid, to);
+		BigInt::mulInto(dst, left, right);
+	}
+
+	/// Writes product of count consecutive numbers from start to dst by balanced tree.
+	void rangeProductInto(BigInt& dst, const BigInt& start, uint32_t count)
+	{
+		if (count <= 16)
+		{
+			dst = BigInt(1u);
+			BigInt x = start;
+			for (uint32_t i = 0; i < count; i++)
+			{
+				BigInt::mulInto(dst, dst, x);
+				x.addInPlace(BigInt(1u));
+			}
+			return;
+		}
+
+		uint32_t half = count / 2;
+		BigInt left, right, mid;
+		BigInt::addInto(mid, start, BigInt(half));
+		rangeProductInto(left, start, half);
+		rangeProductInto(right, mid, count - half);
+		BigInt::mulInto(dst, left, right);
+	}
+
+	/// Writes product of p^e for pairs (p, e) to dst.
+	/// For each bit of exponents from the highest one the result is squared
+	/// and multiplied by product of primes, which have this bit in exponent.
+	void primePowerProductInto(BigInt& dst, const std::vector<std::pair<uint32_t, uint32_t>>& factors)
+	{
+		uint32_t maxExp = 0;
+		for (auto& f : factors)
+			maxExp = std::max(maxExp, f.second);
+
+		BigInt res(1u), part;
+		for (unsigned bit = 32; bit-- > 0;)
+		{
+			if (!(maxExp >> bit))
+				continue;
+
+			BigInt::mulInto(res, res, res);
+
+			// primes are packed into limbs, then limbs are multiplied by tree
+			std::vector<limb_t> packed;
+			limb_t cur = 1;
+			for (auto& f : factors)
+			{
+				if (!((f.second >> bit) & 1))
+					continue;
+
+				if (cur > (limb_t)-1 / f.first)
+				{
+					packed.push_back(cur);
+					cur = 1;
+				}
+				cur *= f.first;
+			}
+			packed.push_back(cur);
+
+			productInto(part, packed, 0, packed.size());
+			BigInt::mulInto(res, res, part);
+		}
+
+		dst = std::move(res);
+	}
+
+	/// Writes n! to dst by prime factorization, power of two is made by shift.
+	void factorialOf(BigInt& dst, uint32_t n)
+	{
+		std::vector<std::pair<uint32_t, uint32_t>> factors;
+		for (uint32_t p : primesUpTo(n))
+		{
+			if (p != 2)
+				factors.emplace_back(p, (uint32_t)factorialExponent(n, p));
+		}
+
+		primePowerProductInto(dst, factors);
+		dst.shiftLeft(factorialExponent(n, 2));
+	}
+
+	/// Writes C(n, k) for k <= n / 2 to dst by prime factorization,
+	/// exponent of each prime is found by Legendre's formula for three factorials.
+	void binomialOf(BigInt& dst, uint32_t n, uint32_t k)
+	{
+		std::vector<std::pair<uint32_t, uint32_t>> factors;
+		for (uint32_t p : primesUpTo(n))
+		{
+			uint64_t e = factorialExponent(n, p) - factorialExponent(k, p) - factorialExponent(n - k, p);
+			if (p != 2 && e)
+				factors.emplace_back(p, (uint32_t)e);
+		}
+
+		primePowerProductInto(dst, factors);
+		dst.shiftLeft(factorialExponent(n, 2) - factorialExponent(k, 2) - factorialExponent(n - k, 2));
+	}
+}
+
+void BigInt::factorialInto(BigInt& dst, const BigInt& n)
+{
+	if (n.isMinus && !n.isZero())
+		throw std::runtime_error("Factorial of negative number!!!");
+
+	if (n.bigNum.size() > 1 || n.bigNum[0] > UINT32_MAX)
+		throw std::runtime_error("Too big argument of factorial!!!");
+
+	factorialOf(dst, (uint32_t)n.bigNum[0]);
+}
+
+void BigInt::binomialInto(BigInt& dst, const BigInt& n, const BigInt& k)
+{
+	if (k.isMinus && !k.isZero())
+	{
+		dst = BigInt();
+		return;
+	}
+
+	// C(n, k) = (-1)^k * C(k - n - 1, k) for negative n
+	BigInt top = n;
+	bool negative = false;
+	if (n.isMinus && !n.isZero())
+	{
+		subInto(top, k, n);
+		subInto(top, top, BigInt(1u));
+		negative = k.bigNum[0] & 1;
+	}
+	else if (top.absLessThan(k))
+	{
+		dst = BigInt();
+		return;
+	}
+
+	// C(n, k) = C(n, n - k)
+	BigInt low;
+	subInto(low, top, k);
+	if (k.absLessThan(low))
+		low = k;
+
+	if (low.bigNum.size() > 1 || low.bigNum[0] > UINT32_MAX)
+		throw std::runtime_error("Too big argument of binomial!!!");
+
+	uint32_t kk = (uint32_t)low.bigNum[0];
+	if (top.bigNum.size() == 1 && top.bigNum[0] <= UINT32_MAX && (uint64_t)kk * 16 >= top.bigNum[0])
+		binomialOf(dst, (uint32_t)top.bigNum[0], kk);
+	else
+	{
+		// for small k numerator n * (n - 1) * ... * (n - k + 1) is shorter than sieve up to n
+		BigInt start, num, den, rem;
+		subInto(start, top, low);
+		start.addInPlace(BigInt(1u));
+		rangeProductInto(num, start, kk);
+		factorialOf(den, kk);
+		divmodInto(dst, rem, num, den);
+	}
+
+	dst.isMinus = negative;
+}
+
+void BigInt::fibPair(BigInt& f, BigInt& f1, uint32_t n)
+{
+	// F(0) = 0, F(-1) = 1
+	f = BigInt();
+	f1 = BigInt(1u);
+
+	BigInt sq, sq1, two(2u);
+	bool odd = false;
+
+	for (uint32_t bit = 1u << 31; bit; bit >>= 1)
+	{
+		if (f.isZero() && !(n & bit))
+			continue;
+
+		// F(2k - 1) = F(k)^2 + F(k - 1)^2
+		// F(2k + 1) = 4 * F(k)^2 - F(k - 1)^2 + 2 * (-1)^k
+		// F(2k) = F(2k + 1) - F(2k - 1)
+		mulInto(sq, f, f);
+		mulInto(sq1, f1, f1);
+		addInto(f1, sq, sq1);
+
+		sq.shiftLeft(2);
+		subInto(f, sq, sq1);
+		addInto(f, f, two, odd);
+
+		odd = (n & bit) != 0;
+		if (odd)
+			subInto(f1, f, f1);
+		else
+			subInto(f, f, f1);
+	}
+}
+
+uint32_t BigInt::toSequenceIndex(const BigInt& n, const std::string& sequence)
+{
+	if (n.bigNum.size() > 1 || n.bigNum[0] > UINT32_MAX)
+		throw std::runtime_error("Too big index of " + sequence + " number!!!");
+
+	return (uint32_t)n.bigNum[0];
+}
+
+void BigInt::fibonacciInto(BigInt& dst, const BigInt& n)
+{
+	uint32_t index = toSequenceIndex(n, "Fibonacci");
+
+	BigInt prev;
+	fibPair(dst, prev, index);
+	dst.isMinus = n.isMinus && !(index & 1) && !dst.isZero();
+}
+
+void BigInt::lucasInto(BigInt& dst, const BigInt& n)
+{
+	uint32_t index = toSequenceIndex(n, "Lucas");
+
+	BigInt f, prev;
+	fibPair(f, prev, index);
+	prev.shiftLeft(1);
+	addInto(dst, f, prev);
+	dst.isMinus = n.isMinus && (index & 1);
+}
+
+namespace
+{
+	/// Primes below 2^16 for trial division and sieving, the table is made on the first use.
+	const std::vector<uint32_t>& smallPrimes()
+	{
+		static const std::vector<uint32_t> primes = primesUpTo(UINT16_MAX);
+		return primes;
+	}
+
+	/// Count of small primes for trial division of number with given bit length.
+	/// Division by a prime is much cheaper than modular multiplication,
+	/// so longer numbers are divided by more primes before exponentiation.
+	size_t trialPrimes(size_t bits)
+	{
+		return std::min(smallPrimes().size(), std::max<size_t>(64, 2 * bits));
+	}
+
+	/// Computes reminders of a with n limbs modulo count primes.
+	/// a is divided once by each product of primes, which fits into one limb.
+	void smallReminders(uint32_t* rems, const limb_t* a, size_t n, const uint32_t* primes, size_t count)
+	{
+		std::vector<limb_t> q(n);
+		for (size_t i = 0; i < count;)
+		{
+			limb_t prod = primes[i];
+			size_t j = i + 1;
+			while (j < count && prod <= (limb_t)-1 / primes[j])
+				prod *= primes[j++];
+
+			limb_t r = limbs::divRem1(q.data(), a, n, prod);
+			for (; i < j; i++)
+				rems[i] = (uint32_t)(r % primes[i]);
+		}
+	}
+
+	/// Computes Jacobi symbol (a / b) for odd b.
+	int jacobi(uint32_t a, uint32_t b)
+	{
+		int res = 1;
+		a %= b;
+		while (a)
+		{
+			while (!(a & 1))
+			{
+				a >>= 1;
+				if ((b & 7) == 3 || (b & 7) == 5)
+					res = -res;
+			}
+
+			std::swap(a, b);
+			if ((a & 3) == 3 && (b & 3) == 3)
+				res = -res;
+			a %= b;
+		}
+
+		return b == 1 ? res : 0;
+	}
+}
+
+bool BigInt::strongPrimeTest(const BigInt& n)
+{
+	std::vector<limb_t> q(n.bigNum.size());
+
+	// the first of 5, -7, 9, -11, ... with (D / n) = -1
+	int d = 5;
+	for (int tries = 1;; tries++)
+	{
+		uint32_t absD = d < 0 ? -d : d;
+		uint32_t r = (uint32_t)limbs::divRem1(q.data(), n.bigNum.data(), n.bigNum.size(), absD);
+
+		// (D / n) = (n mod |D| / |D|) by reciprocity, sign changes for n = 3 mod 4,
+		// if either D is negative or |D| = 3 mod 4
+		int j = jacobi(r, absD);
+		if ((n.bigNum[0] & 3) == 3 && (d < 0) != ((absD & 3) == 3))
+			j = -j;
+
+		// |D| is less than n, so n has a common factor with D
+		if (j == 0)
+			return false;
+		if (j < 0)
+			break;
+
+		// squares have no such D
+		if (tries == 8)
+		{
+			BigInt root;
+			sqrtInto(root, n);
+			mulInto(root, root, root);
+			if (root.isAbsEqual(n))
+				return false;
+		}
+
+		d = d < 0 ? 2 - d : -d - 2;
+	}
+
+	return limbs::isProbablePrime(n.bigNum.data(), n.bigNum.size(), d);
+}
+
+bool BigInt::isPrime(const BigInt& n)
+{
+	if (n.isMinus || n.absLessThan(BigInt(2u)))
+		return false;
+
+	const std::vector<uint32_t>& primes = smallPrimes();
+	size_t count = trialPrimes(n.bitLength());
+
+	std::vector<uint32_t> rems(count);
+	smallReminders(rems.data(), n.bigNum.data(), n.bigNum.size(), primes.data(), count);
+
+	for (size_t i = 0; i < count; i++)
+	{
+		if (rems[i] == 0)
+			return n.bigNum.size() == 1 && n.bigNum[0] == primes[i];
+	}
+
+	// composite number has a prime factor not greater than its square root
+	uint32_t last = primes[count - 1];
+	if (n.absLessThan(BigInt(last * last)))
+		return true;
+
+	return strongPrimeTest(n);
+}
+
+void BigInt::nextPrimeInto(BigInt& dst, const BigInt& n)
+{
+	if (n.isMinus || n.absLessThan(BigInt(2u)))
+	{
+		dst = BigInt(2u);
+		return;
+	}
+
+	BigInt start;
+	addInto(start, n, BigInt(n.bigNum[0] & 1 ? 2u : 1u));
+
+	// short numbers are checked by trial division
+	if (start.bitLength() <= 32)
+	{
+		while (!isPrime(start))
+			start.addInPlace(BigInt(2u));
+
+		dst = std::move(start);
+		return;
+	}
+
+	const std::vector<uint32_t>& primes = smallPrimes();
+	size_t count = trialPrimes(start.bitLength());
+
+	std::vector<uint32_t> rems(count);
+	smallReminders(rems.data(), start.bigNum.data(), start.bigNum.size(), primes.data(), count);
+
+	// window of odd numbers start + 2i covers a few average gaps between primes,
+	// which is about 0.7 * bit length
+	uint32_t window = (uint32_t)start.bitLength() + 64;
+	std::vector<bool> composite(window);
+
+	while (true)
+	{
+		std::fill(composite.begin(), composite.end(), false);
+
+		// primes are less than start, so they are not marked themselves
+		for (size_t k = 1; k < count; k++)
+		{
+			uint64_t p = primes[k];
+
+			// start + 2i = 0 mod p for i = -r / 2 mod p
+			for (uint64_t i = (p - rems[k]) * ((p + 1) / 2) % p; i < window; i += p)
+				composite[i] = true;
+		}
+
+		for (uint32_t i = 0; i < window; i++)
+		{
+			if (composite[i])
+				continue;
+
+			addInto(dst, start, BigInt(2 * i));
+			if (strongPrimeTest(dst))
+				return;
+		}
+
+		start.addInPlace(BigInt(2 * window));
+		for (size_t k = 1; k < count; k++)
+			rems[k] = (uint32_t)((rems[k] + 2 * (uint64_t)window) % primes[k]);
+	}
+}
+
+void BigInt::mulLimbInPlace(limb_t num)
+{
+	limb_t carry = limbs::mul1(bigNum.data(), bigNum.data(), bigNum.size(), num);
+	if (carry)
+		bigNum.push_back(carry);
+
+	trim();
+}
+
+limb_t BigInt::divLimbInPlace(limb_t num)
+{
+	limb_t rem = limbs::divRem1(bigNum.data(), bigNum.data(), bigNum.size(), num);
+	trim();
+
+	return rem;
+}
+
+limb_t BigInt::modLimb(limb_t num) const
+{
+	limb_t rem = 0;
+	for (size_t i = bigNum.size(); i-- > 0;)
+		limbs::divWide(rem, bigNum[i], num, rem);
+
+	return rem;
+}
+
+void BigInt::shiftLeft(size_t bits)
+{
+	if (isZero())
+		return;
+
+	size_t n = bigNum.size();
+	size_t k = bits / LIMB_BITS;
+	unsigned s = bits % LIMB_BITS;
+
+	bigNum.resize(n + k + 1);
+	limb_t* p = bigNum.data();
+
+	// limbs move up by k positions, starting from the high one
+	if (s)
+		p[n + k] = limbs::shiftLeft(p + k, p, n, s);
+	else
+	{
+		std::memmove(p + k, p, n * sizeof(limb_t));
+		p[n + k] = 0;
+	}
+	std::fill(p, p + k, 0);
+
+	trim();
+}
 
-		for (auto& symb : tmp)
-		{
-			auto dig = symb + rem * 10 - '0';
-			rem = dig % 2;
-			symb = dig / 2 + '0';
-		}
+void BigInt::shiftRight(size_t bits)
+{
+	size_t n = bigNum.size();
+	size_t k = bits / LIMB_BITS;
+	unsigned s = bits % LIMB_BITS;
 
-		// trimming
-		while (tmp.size() > 1 && tmp.front() == '0')
-			tmp.erase(0, 1);
+	// rounding down changes negative numbers, if nonzero bits are dropped
+	bool dropped = false;
 
-		binNum.push_back(rem + '0');
+	if (k >= n)
+	{
+		dropped = !isZero();
+		bigNum.assign(1, 0);
 	}
+	else
+	{
+		limb_t* p = bigNum.data();
+		dropped = std::any_of(p, p + k, [](limb_t x) { return x != 0; });
 
-	std::reverse(binNum.begin(), binNum.end());
+		if (s)
+			dropped |= limbs::shiftRight(p, p + k, n - k, s) != 0;
+		else
+			std::memmove(p, p + k, (n - k) * sizeof(limb_t));
 
-	// binary number string to vector of uint32_t
-	for (size_t i = 0; i < binNum.size(); i += 32)
-		bigNum.emplace_back(
-			std::bitset<32>(binNum.substr(i, 32)).to_ulong());
+		bigNum.resize(n - k);
+		trim();
+	}
 
-	std::reverse(bigNum.begin(), bigNum.end());
+	if (isMinus && dropped)
+	{
+		isMinus = false;
+		addInPlace(BigInt(1u));
+		isMinus = true;
+	}
+}
 
-	if (bigNum.empty())
-		bigNum.push_back(0);
+size_t BigInt::toShiftCount(bool saturate) const
+{
+	if (isMinus && !isZero())
+		throw std::runtime_error("Negative shift count!!!");
+
+	if (bigNum.size() > 1 || bigNum[0] > UINT32_MAX)
+	{
+		if (saturate)
+			return SIZE_MAX;
+		throw std::runtime_error("Too big shift count!!!");
+	}
 
+	return (size_t)bigNum[0];
 }
 
-void BigInt::shiftR()
+namespace
 {
-	bigNum.push_back(0);
-	for (size_t i = bigNum.size() - 1; i > 0; i+=-1)
-		bigNum[i] = bigNum[i - 1];
+	/// Bitwise operations on absolute values.
+	enum class BitOp
+	{
+		andOp,
+		andNotOp,
+		iorOp,
+		xorOp
+	};
+
+	/// Computes r = p op q, where shorter operand is extended by zeros.
+	void combineBits(LimbVector& r, const LimbVector& p, const LimbVector& q, BitOp op)
+	{
+		size_t n = std::min(p.size(), q.size());
+		size_t rn = op == BitOp::andOp ? n : op == BitOp::andNotOp ? p.size() : std::max(p.size(), q.size());
+
+		r.resize(rn);
+		switch (op)
+		{
+		case BitOp::andOp:
+			limbs::andN(r.data(), p.data(), q.data(), n);
+			break;
+		case BitOp::andNotOp:
+			limbs::andNotN(r.data(), p.data(), q.data(), n);
+			break;
+		case BitOp::iorOp:
+			limbs::iorN(r.data(), p.data(), q.data(), n);
+			break;
+		case BitOp::xorOp:
+			limbs::xorN(r.data(), p.data(), q.data(), n);
+			break;
+		}
 
-	bigNum[0] = 0;
+		// high limbs of the longer operand meet zeros
+		const LimbVector& longer = p.size() >= q.size() ? p : q;
+		std::copy(longer.begin() + n, longer.begin() + rn, r.begin() + n);
+	}
 }
 
-std::pair<BigInt, uint32_t> BigInt::divInt(uint32_t num) const
+void BigInt::bitwiseInto(BigInt& dst, const BigInt& a, const BigInt& b, char op)
 {
-	BigInt copy = *this;
+	bool aNeg = a.isMinus && !a.isZero();
+	bool bNeg = b.isMinus && !b.isZero();
+
+	// negative number -m has bits ~(m - 1) in two's complement, so operations
+	// are done on m - 1 and complements are moved out by De Morgan's laws
+	BigInt aDec, bDec;
+	if (aNeg)
+	{
+		aDec = a;
+		aDec.isMinus = false;
+		aDec.subInPlace(BigInt(1u));
+	}
+	if (bNeg)
+	{
+		bDec = b;
+		bDec.isMinus = false;
+		bDec.subInPlace(BigInt(1u));
+	}
+
+	const LimbVector& x = aNeg ? aDec.bigNum : a.bigNum;
+	const LimbVector& y = bNeg ? bDec.bigNum : b.bigNum;
 
-	uint32_t rem = 0;
+	bool resNeg = false;
+	LimbVector res;
 
-	for (int i = bigNum.size() - 1; i >= 0; i--)
+	if (op == '&')
 	{
-		uint64_t dig = bigNum[i] + rem * ((uint64_t)UINT32_MAX + 1);
-		rem = (uint32_t)(dig % num);
-		copy.bigNum[i] = dig / num;
+		// ~x & ~y = ~(x | y), ~x & y = y & ~x
+		resNeg = aNeg && bNeg;
+		combineBits(res, aNeg ? y : x, aNeg ? x : y,
+			resNeg ? BitOp::iorOp : aNeg || bNeg ? BitOp::andNotOp : BitOp::andOp);
+	}
+	else if (op == '|')
+	{
+		// ~x | ~y = ~(x & y), ~x | y = ~(x & ~y)
+		resNeg = aNeg || bNeg;
+		combineBits(res, bNeg && !aNeg ? y : x, bNeg && !aNeg ? x : y,
+			aNeg && bNeg ? BitOp::andOp : resNeg ? BitOp::andNotOp : BitOp::iorOp);
+	}
+	else
+	{
+		// ~x ^ y = ~(x ^ y), ~x ^ ~y = x ^ y
+		resNeg = aNeg != bNeg;
+		combineBits(res, x, y, BitOp::xorOp);
 	}
 
-	while (copy.bigNum.size() > 1 && copy.bigNum.back() == 0)
-		copy.bigNum.erase(copy.bigNum.end() - 1);
+	// result ~m is -(m + 1)
+	if (resNeg)
+	{
+		limb_t carry = 1;
+		for (size_t i = 0; i < res.size() && carry; i++)
+			res[i] = limbs::addCarry(res[i], 0, carry);
+		if (carry)
+			res.push_back(carry);
+	}
 
-	return std::pair<BigInt, uint32_t>(copy, rem);
+	dst.bigNum = std::move(res);
+	dst.isMinus = resNeg;
+	dst.trim();
 }
 
-std::pair<BigInt, BigInt> BigInt::divide(const BigInt& num) const
+BigInt BigInt::andBigInt(const BigInt& num2) const
+{
+	BigInt res;
+	bitwiseInto(res, *this, num2, '&');
+	return res;
+}
+
+BigInt BigInt::orBigInt(const BigInt& num2) const
+{
+	BigInt res;
+	bitwiseInto(res, *this, num2, '|');
+	return res;
+}
+
+BigInt BigInt::xorBigInt(const BigInt& num2) const
+{
+	BigInt res;
+	bitwiseInto(res, *this, num2, '^');
+	return res;
+}
+
+BigInt BigInt::notBigInt() const
+{
+	// ~x = -(x + 1)
+	BigInt res;
+	addInto(res, *this, BigInt(1u), false);
+	res.isMinus = !res.isMinus;
+	return res;
+}
+
+void BigInt::powModInto(BigInt& dst, const BigInt& base, const BigInt& exp, const BigInt& m)
 {
-	if (num.bigNum.size() == 1 && num.bigNum[0] == 0)
+	if (m.isZero())
 		throw std::runtime_error("Division by zero!!!");
 
-	bool finalSign = isMinus != num.isMinus;
+	if (exp.isMinus && !exp.isZero())
+		throw std::runtime_error("Negative exponent!!!");
+
+	BigInt absM(m);
+	absM.isMinus = false;
+
+	// base is reduced to [0, |m|) and padded to length of modulus
+	BigInt q, a;
+	divmodInto(q, a, base, absM);
+
+	size_t n = absM.bigNum.size();
+	a.bigNum.resize(n);
+
+	LimbVector res(n);
+	limbs::powMod(res.data(), a.bigNum.data(), exp.bigNum.data(), exp.bigNum.size(), absM.bigNum.data(), n);
 
-	if (num.bigNum.size() == 1)
+	dst.bigNum = std::move(res);
+	dst.isMinus = false;
+	dst.trim();
+
+	// negative modulus gives reminder in (m, 0]
+	if (m.isMinus && !dst.isZero())
+		subInto(dst, dst, absM);
+}
+
+uint64_t BigInt::toExponent(bool unitBase) const
+{
+	if (isMinus && !isZero())
+		throw std::runtime_error("Negative exponent!!!");
+
+	if (unitBase)
+		return bigNum[0] & 1 ? 1 : isZero() ? 0 : 2;
+
+	if (bigNum.size() > 1 || bigNum[0] > UINT32_MAX)
+		throw std::runtime_error("Too big exponent!!!");
+
+	return (uint64_t)bigNum[0];
+}
+
+void BigInt::powInto(BigInt& dst, const BigInt& base, uint64_t exp)
+{
+	if (exp == 0)
 	{
-		auto res = divInt(num.bigNum[0]);
-		res.first.isMinus = finalSign;
-		BigInt rem(res.second);
-		rem.isMinus = isMinus;
+		dst = BigInt(1u);
+		return;
+	}
 
-		if (finalSign && res.second)
-		{
-			bool tmp = res.first.isMinus;
-			res.first.isMinus = false;
-			res.first = res.first.addBigInt("1");
-			res.first.isMinus = tmp;
+	unsigned bits = 0;
+	while (bits < 64 && (exp >> bits) != 0)
+		bits++;
 
-			rem = subBigInt(num.multiplyBigInt(res.first));
-		}
+	// window size grows with exponent, so precomputed odd powers
+	// b, b^3, ..., b^(2^k - 1) save more multiplications than they cost
+	unsigned k = bits <= 8 ? 1 : bits <= 24 ? 2 : 3;
 
-		return { res.first, rem };
+	std::vector<BigInt> odd(1, base);
+	if (k > 1)
+	{
+		BigInt sqr;
+		mulInto(sqr, base, base);
+		odd.resize((size_t)1 << (k - 1));
+		for (size_t i = 1; i < odd.size(); i++)
+			mulInto(odd[i], odd[i - 1], sqr);
 	}
 
-	if (absLessThan(num))
+	// bits are scanned from the high one, each window starts and ends with one bit
+	BigInt res, tmp;
+	bool first = true;
+
+	for (int i = (int)bits - 1; i >= 0;)
 	{
-		BigInt rem(*this);
-		rem.isMinus = isMinus;
+		if (!((exp >> i) & 1))
+		{
+			mulInto(tmp, res, res);
+			std::swap(res, tmp);
+			i--;
+			continue;
+		}
+
+		int j = std::max(i - (int)k + 1, 0);
+		while (!((exp >> j) & 1))
+			j++;
+
+		size_t window = (size_t)((exp >> j) & ((1u << (i - j + 1)) - 1));
 
-		if (!finalSign)
+		if (first)
 		{
-			return { BigInt(0u), rem };
+			res = odd[window >> 1];
+			first = false;
 		}
 		else
 		{
-			BigInt res = "-1";
+			for (int t = j; t <= i; t++)
+			{
+				mulInto(tmp, res, res);
+				std::swap(res, tmp);
+			}
+			mulInto(tmp, res, odd[window >> 1]);
+			std::swap(res, tmp);
+		}
+
+		i = j - 1;
+	}
+
+	dst = std::move(res);
+}
+
+namespace
+{
+	/// Count of decimal digits, by which number is multiplied in one pass over limbs.
+	constexpr size_t LIMB_DIGITS = LIMB_BITS == 64 ? 19 : 9;
+
+	// 10^k = 5^k * 2^k, so powers of ten are kept as powers of five,
+	// which are shorter, and multiplied by 2^k with a shift
+
+	/// Gives 5^(2^i). Powers are computed by squaring once and kept for next calls.
+	/// Deque doesn't move kept powers, when it grows.
+	const BigInt& pow5Squares(size_t i)
+	{
+		static std::deque<BigInt> powers(1, BigInt(5u));
+		static std::mutex mtx;
 
-			rem = subBigInt(num.multiplyBigInt(res));
+		std::lock_guard<std::mutex> lock(mtx);
 
-			return { res, rem };
+		while (powers.size() <= i)
+		{
+			BigInt next;
+			BigInt::mulInto(next, powers.back(), powers.back());
+			powers.push_back(std::move(next));
 		}
+
+		return powers[i];
 	}
 
-	BigInt divisor(num);
-	divisor.isMinus = false;
-	BigInt rem(0u);
-	BigInt res;
-	res.bigNum.clear();
-	for (size_t i = bigNum.size() - 1;; i += -1)
+	/// Gives 5^k as product of powers 5^(2^i) for bits of k.
+	/// Several last powers are kept, so repeated alignment
+	/// by the same count of digits needs no new power.
+	BigInt pow5(size_t k)
 	{
-		rem.bigNum[0] = bigNum[i];
-		if (rem.absLessThan(divisor) && i != 0)
+		static std::map<size_t, BigInt> recent;
+		static std::mutex mtx;
+
 		{
-			rem.shiftR();
-			continue;
+			std::lock_guard<std::mutex> lock(mtx);
+			auto it = recent.find(k);
+			if (it != recent.end())
+				return it->second;
 		}
 
-		uint32_t _divisor_small = 0, koef = 1;
-		BigInt tmp(divisor);
-		while (divisor.absLessThan(rem))
-		{
-			if (rem.absLessThan(tmp))
-			{
-				tmp = divisor;
-				koef = 1;
-			}
+		BigInt res(1u);
+		for (size_t i = 0; (k >> i) != 0; i++)
+			if ((k >> i) & 1)
+				BigInt::mulInto(res, res, pow5Squares(i));
 
-			_divisor_small += koef;
-			rem = rem.subBigInt(tmp);
-			tmp = tmp.multiplyBigInt(BigInt(2u));
-			koef *= 2;
-		}
+		std::lock_guard<std::mutex> lock(mtx);
+		if (recent.size() >= 16)
+			recent.clear();
+		recent.emplace(k, res);
 
-		res.shiftR();
-		res.bigNum[0] = _divisor_small;
+		return res;
+	}
+}
 
-		if (i == 0) break;
-		rem.shiftR();
+void BigInt::mulPow10Into(BigInt& dst, const BigInt& a, size_t k)
+{
+	if (k > 2 * LIMB_DIGITS)
+	{
+		mulInto(dst, a, pow5(k));
+		dst.shiftLeft(k);
+		return;
 	}
 
-	rem.isMinus = isMinus;
+	// 10^k has at most k * log2(10) bits
+	size_t n = a.bigNum.size();
+	LimbVector res;
+	res.reserve(n + k * 3322 / 1000 / LIMB_BITS + 2);
+	res.assign(n, 0);
+	std::copy(a.bigNum.begin(), a.bigNum.end(), res.begin());
 
-	if (finalSign && !rem.isZero())
+	// multiply by the largest powers of ten, which fit into a limb
+	while (k > 0)
 	{
-		res.isMinus = false;
-		res = res.addBigInt("1");
+		size_t digits = std::min(k, LIMB_DIGITS);
+		limb_t m = 1;
+		for (size_t i = 0; i < digits; i++)
+			m *= 10;
 
-		res.isMinus = finalSign;
+		limb_t carry = limbs::mul1(res.data(), res.data(), res.size(), m);
+		if (carry)
+			res.push_back(carry);
 
-		rem = subBigInt(num.multiplyBigInt(res));
+		k -= digits;
 	}
 
-	res.isMinus = finalSign;
-
-	return { res, rem };
+	dst.isMinus = a.isMinus;
+	dst.bigNum = std::move(res);
+	dst.trim();
 }
 
-bool BigInt::absLessThan(const BigInt& num2) const
+size_t BigInt::stripPow10(size_t maxZeros)
 {
-	if (this->bigNum.size() < num2.bigNum.size())
-		return true;
-	else if (this->bigNum.size() > num2.bigNum.size())
-		return false;
-
-	for (auto i = this->bigNum.size() - 1; i >= 0; i--)
+	if (isZero())
+		return maxZeros;
+
+	// each decimal zero is a factor 2, so zero bits at the end bound their count
+	size_t low = 0;
+	while (bigNum[low / LIMB_BITS] == 0)
+		low += LIMB_BITS;
+	for (limb_t x = bigNum[low / LIMB_BITS]; !(x & 1); x >>= 1)
+		low++;
+
+	maxZeros = std::min(maxZeros, low);
+	if (maxZeros == 0 || modLimb(5) != 0)
+		return 0;
+
+	// exponent of five is found by its bits from the highest one,
+	// quotient by 5^(2^i) is kept only if reminder is zero
+	size_t i = 0;
+	while (((size_t)2 << i) <= maxZeros)
+		i++;
+
+	size_t zeros = 0;
+	BigInt q, r;
+	for (i++; i-- > 0;)
 	{
-		if (this->bigNum[i] < num2.bigNum[i])
-			return true;
-		else if (this->bigNum[i] > num2.bigNum[i])
-			return false;
+		size_t step = (size_t)1 << i;
+		if (zeros + step > maxZeros)
+			continue;
 
-		if (i == 0) break;
+		divmodInto(q, r, *this, pow5Squares(i));
+		if (r.isZero())
+		{
+			std::swap(*this, q);
+			zeros += step;
+		}
 	}
 
-	return false;
+	shiftRight(zeros);
+	return zeros;
+}
+
+bool BigInt::absLessThan(const BigInt& num2) const
+{
+	if (this->bigNum.size() != num2.bigNum.size())
+		return this->bigNum.size() < num2.bigNum.size();
+
+	return limbs::cmp(bigNum.data(), num2.bigNum.data(), bigNum.size()) < 0;
 }
 
 bool BigInt::isAbsEqual(const BigInt& num2) const
@@ -210,11 +1482,15 @@ bool BigInt::isAbsEqual(const BigInt& num2) const
 	if (bigNum.size() != num2.bigNum.size())
 		return false;
 
-	for (size_t i = 0; i < bigNum.size(); i++)
-		if (bigNum[i] != num2.bigNum[i])
-			return false;
+	return limbs::cmp(bigNum.data(), num2.bigNum.data(), bigNum.size()) == 0;
+}
 
-	return true;
+size_t BigInt::bitLength() const
+{
+	if (isZero())
+		return 0;
+
+	return bigNum.size() * LIMB_BITS - limbs::countLeadingZeros(bigNum.back());
 }
 
 bool BigInt::isZero() const
@@ -224,46 +1500,13 @@ bool BigInt::isZero() const
 
 std::string BigInt::toString(bool zeroMinus) const
 {
-	std::vector<uint32_t> copy = bigNum;
-	std::reverse(copy.begin(), copy.end());
-
-	std::string bitStr;
-	std::string res;
-
-	/// convert vector of uint32_t to binary number string
-	for (size_t i = 0; i < copy.size(); i++)
-		bitStr += std::bitset<32>(copy[i]).to_string();
-
-	/// convert bin num str to dec num str
-	while (bitStr.compare("0") != 0)
-	{
-		// Euclidean division
-		uint8_t rem = 0;
-		for (auto& bit : bitStr)
-		{
-			rem = rem * 2 + bit - '0';
-			if (rem >= 10)
-			{
-				bit = '1';
-				rem -= 10;
-			}
-			else
-				bit = '0';
-		}
-
-		res.push_back(rem + '0');
-
-		// trimming
-		while (bitStr.size() > 1 && bitStr.front() == '0')
-			bitStr.erase(0, 1);
-	}
+	bool minus = isMinus && (zeroMinus || !(bigNum.size() == 1 && bigNum[0] == 0));
 
-	std::reverse(res.begin(), res.end());
+	// digits are written right after the sign, so long string isn't copied
+	std::string res(minus + limbs::decimalDigits(bigNum.size()), '-');
+	res.resize(minus + limbs::toDecimal(&res[minus], bigNum.data(), bigNum.size()));
 
-	if(!zeroMinus)
-		return (isMinus && !(bigNum.size() == 1 && bigNum[0] == 0) ? "-" : "") + res;
-	else
-		return (isMinus ? "-" : "") + res;
+	return res;
 }
 
 bool BigInt::operator<(const BigInt& num2) const
@@ -276,143 +1519,110 @@ bool BigInt::operator<(const BigInt& num2) const
 	return absLessThan(num2);
 }
 
-BigInt BigInt::addBigInt(BigInt num2) const
+void BigInt::addInto(BigInt& dst, const BigInt& a, const BigInt& b, bool negate)
 {
-	BigInt copy = *this;
-	bool finalSign = false;
-	bool subtraction = false;
+	bool aMinus = a.isMinus;
+	bool bMinus = b.isMinus != negate;
 
-	/// Final sign and operation computing
-	if (this->isMinus == num2.isMinus) // numbers have same signs
-	{
-		finalSign = copy.isMinus;
-	}
-	else
+	// sizes and order are found before dst, which may be a or b, is resized
+	size_t an = a.bigNum.size(), bn = b.bigNum.size();
+
+	if (aMinus == bMinus)
 	{
-		bool leftIsModuloLess = absLessThan(num2);
-		finalSign = (!leftIsModuloLess && copy.isMinus) ||
-			(leftIsModuloLess && num2.isMinus);
+		const BigInt& x = an >= bn ? a : b;
+		const BigInt& y = an >= bn ? b : a;
+		size_t xn = std::max(an, bn), yn = std::min(an, bn);
 
-		if (leftIsModuloLess) // |this| < |num2|
-			std::swap(copy, num2);
+		dst.bigNum.resize(xn + 1);
+		limb_t* r = dst.bigNum.data();
+		r[xn] = limbs::add(r, x.bigNum.data(), xn, y.bigNum.data(), yn);
 
-		subtraction = true;
+		dst.isMinus = aMinus;
 	}
-
-
-	for (size_t i = 0; i < num2.bigNum.size(); i++)
+	else
 	{
-		if (i >= copy.bigNum.size())
-		{
-			copy.bigNum.push_back(num2.bigNum[i]);
-		}
-		else if (!subtraction) // addition
-		{
-			size_t k = i;
-			uint32_t tmp = num2.bigNum[i];
-			uint32_t old_tmp = 0;
-			do
-			{
-				if (k == copy.bigNum.size())
-					copy.bigNum.push_back(0);
-
-				copy.bigNum[k] += tmp;
+		// |a| < |b| gives the sign of b, equal absolute values keep the sign of a
+		bool less = a.absLessThan(b);
+		const BigInt& x = less ? b : a;
+		const BigInt& y = less ? a : b;
+		size_t xn = less ? bn : an, yn = less ? an : bn;
 
-				old_tmp = tmp;
-				tmp = 1;
-			} while (copy.bigNum[k++] < old_tmp);
-		}
-		else // subtraction
-		{
-			size_t k = i;
-			uint32_t tmp = num2.bigNum[i];
-			uint32_t old_tmp = 0;
-			do
-			{
-				old_tmp = copy.bigNum[k];
+		dst.bigNum.resize(xn);
+		limbs::sub(dst.bigNum.data(), x.bigNum.data(), xn, y.bigNum.data(), yn);
 
-				copy.bigNum[k] -= tmp;
-				tmp = 1;
-			} while (copy.bigNum[k++] > old_tmp);
-		}
+		dst.isMinus = less ? bMinus : aMinus;
 	}
 
-	while (copy.bigNum[copy.bigNum.size() - 1] == 0 && copy.bigNum.size() != 1)
-		copy.bigNum.pop_back();
+	dst.trim();
+}
 
-	copy.isMinus = finalSign;
+BigInt& BigInt::addInPlace(const BigInt& num2)
+{
+	addInto(*this, *this, num2, false);
+	return *this;
+}
 
-	return copy;
+BigInt& BigInt::subInPlace(const BigInt& num2)
+{
+	addInto(*this, *this, num2, true);
+	return *this;
 }
 
-BigInt BigInt::subBigInt(const BigInt& num2) const
+BigInt BigInt::addBigInt(const BigInt& num2) const
 {
-	BigInt num = BigInt(num2);
-	num.isMinus = !num.isMinus;
-	return addBigInt(num);
+	BigInt res;
+	addInto(res, *this, num2, false);
+	return res;
 }
 
-BigInt BigInt::multiplyBigInt(const BigInt& num2) const
+BigInt BigInt::subBigInt(const BigInt& num2) const
 {
 	BigInt res;
+	addInto(res, *this, num2, true);
+	return res;
+}
 
-	if ((bigNum.size() == 1 && bigNum[0] == 0) ||
-		(num2.bigNum.size() == 1 && num2.bigNum[0] == 0))
+void BigInt::mulInto(BigInt& dst, const BigInt& a, const BigInt& b)
+{
+	if (&dst == &a || &dst == &b)
 	{
-		res.isMinus = this->isMinus != num2.isMinus;
-		return res;
+		BigInt res;
+		mulInto(res, a, b);
+		dst = std::move(res);
+		return;
 	}
 
-	for (size_t i = 1; i < bigNum.size(); i++)res.bigNum.push_back(0);
-
-	res.isMinus = this->isMinus != num2.isMinus;
+	dst.isMinus = a.isMinus != b.isMinus;
 
-	uint64_t tmp = 0;
-	uint32_t carry = 0;
-	size_t iter = 0;
-	for (size_t i = 0; i < num2.bigNum.size(); i++, iter++)
+	if (a.isZero() || b.isZero())
 	{
-		for (size_t j = 0; j < bigNum.size(); j++)
-		{
-			tmp = (uint64_t)num2.bigNum[i] * bigNum[j];
-
-			if (iter + j == res.bigNum.size())
-				res.bigNum.push_back(0);
-
-			size_t k = iter + j;
-			carry = (uint32_t)tmp;
-			uint32_t old_carry = 0;
-			do
-			{
-				if (k == res.bigNum.size())
-					res.bigNum.push_back(0);
-
-				res.bigNum[k] += carry;
-				old_carry = carry;
-
-				carry = 1;
-			} while (res.bigNum[k++] < old_carry);
-
-
-			k = iter + j + 1;
-			carry = tmp / ((uint64_t)UINT32_MAX + 1);
-			old_carry = 0;
-			do
-			{
-				if (k == res.bigNum.size())
-					res.bigNum.push_back(0);
+		dst.bigNum.assign(1, 0);
+		return;
+	}
 
-				res.bigNum[k] += carry;
-				old_carry = carry;
+	// equal operands are squared, which computes each cross product once
+	if (&a == &b || a.isAbsEqual(b))
+	{
+		dst.bigNum.resize(2 * a.bigNum.size());
+		limbs::sqr(dst.bigNum.data(), a.bigNum.data(), a.bigNum.size());
+	}
+	else
+	{
+		// limbs::mul needs the longer operand first
+		const LimbVector& x = a.bigNum.size() >= b.bigNum.size() ? a.bigNum : b.bigNum;
+		const LimbVector& y = a.bigNum.size() >= b.bigNum.size() ? b.bigNum : a.bigNum;
 
-				carry = 1;
-			} while (res.bigNum[k++] < old_carry);
-		}
+		dst.bigNum.resize(x.size() + y.size());
+		limbs::mul(dst.bigNum.data(), x.data(), x.size(), y.data(), y.size());
 	}
 
-	while (res.bigNum.size() > 1 && res.bigNum.back() == 0)
-		res.bigNum.erase(res.bigNum.end() - 1);
+	dst.trim();
+}
 
+BigInt BigInt::multiplyBigInt(const BigInt& num2) const
+{
+	BigInt res;
+	mulInto(res, *this, num2);
 	return res;
 }
 
@@ -425,7 +1635,8 @@ IBigNum_ptr BigInt::operator+(const IBigNum_ptr& num2) const
 {
 	if (BigInt* kk = dynamic_cast<BigInt*>(num2.get()))
 	{
-		IBigNum_ptr res(new BigInt(addBigInt(*kk)));
+		std::shared_ptr<BigInt> res = std::make_shared<BigInt>();
+		addInto(*res, *this, *kk, false);
 		return res;
 	}
 	else
@@ -442,7 +1653,8 @@ IBigNum_ptr BigInt::operator+(long num2) const
 	if (num2 < 0)
 		t.isMinus = true;
 
-	IBigNum_ptr res(new BigInt(addBigInt(t)));
+	std::shared_ptr<BigInt> res = std::make_shared<BigInt>();
+	addInto(*res, *this, t, false);
 	return res;
 }
 
@@ -450,7 +1662,8 @@ IBigNum_ptr BigInt::operator-(const IBigNum_ptr& num2) const
 {
 	if (BigInt* kk = dynamic_cast<BigInt*>(num2.get()))
 	{
-		IBigNum_ptr res(new BigInt(subBigInt(*kk)));
+		std::shared_ptr<BigInt> res = std::make_shared<BigInt>();
+		addInto(*res, *this, *kk, true);
 		return res;
 	}
 	else
@@ -467,7 +1680,8 @@ IBigNum_ptr BigInt::operator*(const IBigNum_ptr& num2) const
 {
 	if (BigInt* kk = dynamic_cast<BigInt*>(num2.get()))
 	{
-		IBigNum_ptr res(new BigInt(multiplyBigInt(*kk)));
+		std::shared_ptr<BigInt> res = std::make_shared<BigInt>();
+		mulInto(*res, *this, *kk);
 		return res;
 	}
 	else
@@ -481,17 +1695,110 @@ IBigNum_ptr BigInt::operator*(const IBigNum_ptr& num2) const
 IBigNum_ptr BigInt::operator/(const IBigNum_ptr& num2) const
 {
 	if (BigInt* kk = dynamic_cast<BigInt*>(num2.get()))
-		return IBigNum_ptr(new BigInt(divide(*kk).first));
+	{
+		std::shared_ptr<BigInt> res = std::make_shared<BigInt>();
+		BigInt rem;
+		divmodInto(*res, rem, *this, *kk);
+		return res;
+	}
 	else
-		throw std::runtime_error("Division is not defined for BigDouble!!!");
+		return BigDouble(*this, 0) / num2;
 }
 
 IBigNum_ptr BigInt::operator%(const IBigNum_ptr& num2) const
 {
 	if (BigInt* kk = dynamic_cast<BigInt*>(num2.get()))
-		return IBigNum_ptr(new BigInt(divide(*kk).second));
+	{
+		std::shared_ptr<BigInt> res = std::make_shared<BigInt>();
+		BigInt quot;
+		divmodInto(quot, *res, *this, *kk);
+		return res;
+	}
+	else
+		return BigDouble(*this, 0) % num2;
+}
+
+IBigNum_ptr BigInt::power(const IBigNum_ptr& num2) const
+{
+	if (BigInt* kk = dynamic_cast<BigInt*>(num2.get()))
+	{
+		std::shared_ptr<BigInt> res = std::make_shared<BigInt>();
+		powInto(*res, *this, kk->toExponent(bigNum.size() == 1 && bigNum[0] <= 1));
+		return res;
+	}
+	else
+		throw std::runtime_error("Exponent must be integer!!!");
+}
+
+IBigNum_ptr BigInt::operator<<(const IBigNum_ptr& num2) const
+{
+	if (BigInt* kk = dynamic_cast<BigInt*>(num2.get()))
+	{
+		size_t bits = kk->toShiftCount();
+
+		// memory for shifted number is reserved before copying
+		std::shared_ptr<BigInt> res = std::make_shared<BigInt>();
+		res->bigNum.reserve(bigNum.size() + bits / LIMB_BITS + 1);
+		*res = *this;
+		res->shiftLeft(bits);
+		return res;
+	}
+	else
+		throw std::runtime_error("Shift is not defined for BigDouble!!!");
+}
+
+IBigNum_ptr BigInt::operator>>(const IBigNum_ptr& num2) const
+{
+	if (BigInt* kk = dynamic_cast<BigInt*>(num2.get()))
+	{
+		std::shared_ptr<BigInt> res = std::make_shared<BigInt>(*this);
+		// any count not less than bit length gives 0 or -1
+		res->shiftRight(kk->toShiftCount(true));
+		return res;
+	}
+	else
+		throw std::runtime_error("Shift is not defined for BigDouble!!!");
+}
+
+IBigNum_ptr BigInt::operator&(const IBigNum_ptr& num2) const
+{
+	if (BigInt* kk = dynamic_cast<BigInt*>(num2.get()))
+	{
+		std::shared_ptr<BigInt> res = std::make_shared<BigInt>();
+		bitwiseInto(*res, *this, *kk, '&');
+		return res;
+	}
+	else
+		throw std::runtime_error("Bitwise operations are not defined for BigDouble!!!");
+}
+
+IBigNum_ptr BigInt::operator|(const IBigNum_ptr& num2) const
+{
+	if (BigInt* kk = dynamic_cast<BigInt*>(num2.get()))
+	{
+		std::shared_ptr<BigInt> res = std::make_shared<BigInt>();
+		bitwiseInto(*res, *this, *kk, '|');
+		return res;
+	}
+	else
+		throw std::runtime_error("Bitwise operations are not defined for BigDouble!!!");
+}
+
+IBigNum_ptr BigInt::operator^(const IBigNum_ptr& num2) const
+{
+	if (BigInt* kk = dynamic_cast<BigInt*>(num2.get()))
+	{
+		std::shared_ptr<BigInt> res = std::make_shared<BigInt>();
+		bitwiseInto(*res, *this, *kk, '^');
+		return res;
+	}
 	else
-		throw std::runtime_error("Mod is not defined for BigDouble!!!");
+		throw std::runtime_error("Bitwise operations are not defined for BigDouble!!!");
+}
+
+IBigNum_ptr BigInt::operator~() const
+{
+	return std::make_shared<BigInt>(notBigInt());
 }
 
 IBigNum& BigInt::operator=(const std::string& num)
@@ -507,3 +1814,11 @@ BigInt& BigInt::operator=(const BigInt& num2)
 
 	return *this;
 }
+
+BigInt& BigInt::operator=(BigInt&& num2) noexcept
+{
+	bigNum = std::move(num2.bigNum);
+	isMinus = num2.isMinus;
+
+	return *this;
+}
\ No newline at end of file
@@ -14,8 +14,12 @@
 #endif
 
 #include "../hdrs/Tester.h"
+#include "../hdrs/Benchmark.h"
 #include "../hdrs/Historizer.h"
 #include "../hdrs/Evaluator.h"
+#include "../hdrs/Limbs.h"
+#include "../hdrs/Kernels.h"
+#include "../hdrs/ThreadPool.h"
 
 #include <stdlib.h>
 #include <iostream>
@@ -82,6 +86,9 @@ void printWelcome()
 	std::cout << "   clv - clear all variables" << std::endl;
 	std::cout << "   clh - clear current history" << std::endl;
 	std::cout << "   test - test file examples.tst" << std::endl;
+	std::cout << "   bench - measure speed of algorithms" << std::endl;
+	std::cout << "   threads [n] - show or set count of threads, 0 means all cores" << std::endl;
+	std::cout << "   precision [n] - show or set count of fractional digits of division" << std::endl;
 	std::cout << "   exit - exit from calculator" << std::endl;
 	std::cout << "  All another sentences are considered as math expressions!" << std::endl << std::endl;
 }
@@ -126,6 +133,42 @@ void commandHandler(const std::string& command)
 	{
 		Tester::getInstance().testProgram();
 	}
+	else if (words[0] == "bench" && words.size() == 1)
+	{
+		Benchmark::getInstance().benchProgram();
+	}
+	else if (words[0] == "threads" && words.size() <= 2)
+	{
+		// show or change count of threads for long multiplication
+		if (words.size() == 2)
+		{
+			if (words[1].find_first_not_of("0123456789") != std::string::npos || words[1].length() > 4)
+			{
+				std::cout << "eval:~# Wrong count of threads!!!" << std::endl;
+				return;
+			}
+
+			ThreadPool::getInstance().setThreads(std::stoul(words[1]));
+		}
+
+		std::cout << "eval:~# Threads: " << ThreadPool::getInstance().threads() << std::endl;
+	}
+	else if (words[0] == "precision" && words.size() <= 2)
+	{
+		// show or change count of fractional digits of quotient of big doubles
+		if (words.size() == 2)
+		{
+			if (words[1].find_first_not_of("0123456789") != std::string::npos || words[1].length() > 9)
+			{
+				std::cout << "eval:~# Wrong precision!!!" << std::endl;
+				return;
+			}
+
+			Evaluator::getInstance().setPrecision(std::stoul(words[1]));
+		}
+
+		std::cout << "eval:~# Precision: " << Evaluator::getInstance().getPrecision() << std::endl;
+	}
 	else
 	{
 		// evaluate
@@ -239,6 +282,82 @@ void BigInt_test()
 	*b = "-9008236478";
 	assert(((*a) * b)->toString() == "25074414378475871002310");
 
+	// (10^n - 1)^2 = 10^2n - 2 * 10^n + 1, long enough for Karatsuba and Toom-3
+	*a = std::string(3000, '9');
+	*b = std::string(2999, '9');
+	assert(((*a) * a)->toString() == std::string(2999, '9') + "8" + std::string(2999, '0') + "1");
+	assert(((*a) * b)->toString() == std::string(2998, '9') + "89" + std::string(2998, '0') + "1");
+
+	// long decimal strings are converted the same way by both conversion algorithms
+	std::string longDigits;
+	for (size_t i = 0; i < 4000; i++)
+		longDigits.push_back((char)('0' + (i * i + 7 * i) % 10));
+	size_t oldRadix = limbs::radixThreshold;
+	limbs::radixThreshold = SIZE_MAX;
+	BigInt parsed1("-000" + longDigits);
+	assert(parsed1.toString() == "-" + longDigits.substr(1));
+	limbs::radixThreshold = 1;
+	BigInt parsed2("-000" + longDigits);
+	assert(parsed2.toString() == "-" + longDigits.substr(1));
+
+	// and by halves on the thread pool
+	size_t oldParallel = limbs::parallelThreshold, oldThreads = ThreadPool::getInstance().threads();
+	ThreadPool::getInstance().setThreads(4);
+	limbs::parallelThreshold = 2;
+	BigInt parsed3("-" + longDigits);
+	assert(parsed3.toString() == "-" + longDigits.substr(1));
+	ThreadPool::getInstance().setThreads(oldThreads);
+	limbs::parallelThreshold = oldParallel;
+
+	limbs::radixThreshold = oldRadix;
+	assert(parsed1.isAbsEqual(parsed3));
+	assert(parsed1.isAbsEqual(parsed2) && parsed2.checkMinus());
+
+	// all multiplication algorithms give the same result
+	BigInt m1(std::string(2500, '7') + "1"), m2(std::string(1900, '3') + "9");
+	std::string mulExpected = m1.multiplyBigInt(m2).toString();
+	std::string sqrExpected = m1.multiplyBigInt(m1.addBigInt(BigInt(1u))).subBigInt(m1).toString();
+	size_t oldKaratsuba = limbs::karatsubaThreshold, oldToom3 = limbs::toom3Threshold, oldNTT = limbs::nttThreshold;
+
+	limbs::nttThreshold = SIZE_MAX;
+	limbs::karatsubaThreshold = SIZE_MAX;
+	assert(m1.multiplyBigInt(m2).toString() == mulExpected);
+	assert(m1.multiplyBigInt(m1).toString() == sqrExpected);
+	limbs::karatsubaThreshold = 4;
+	limbs::toom3Threshold = SIZE_MAX;
+	assert(m1.multiplyBigInt(m2).toString() == mulExpected);
+	assert(m1.multiplyBigInt(m1).toString() == sqrExpected);
+	limbs::toom3Threshold = 4;
+	assert(m1.multiplyBigInt(m2).toString() == mulExpected);
+	assert(m2.multiplyBigInt(m1).toString() == mulExpected);
+	assert(m1.multiplyBigInt(m1).toString() == sqrExpected);
+	limbs::nttThreshold = 1;
+	assert(m1.multiplyBigInt(m2).toString() == mulExpected);
+	assert(m1.multiplyBigInt(BigInt(m1)).toString() == sqrExpected);
+	assert(((*a) * a)->toString() == std::string(2999, '9') + "8" + std::string(2999, '0') + "1");
+
+	// the same with independent products on the thread pool
+	ThreadPool::getInstance().setThreads(4);
+	limbs::parallelThreshold = 8;
+	limbs::karatsubaThreshold = 8;
+	for (size_t toom3 : { SIZE_MAX, (size_t)16 })
+	{
+		limbs::toom3Threshold = toom3;
+		for (size_t ntt : { SIZE_MAX, (size_t)64 })
+		{
+			limbs::nttThreshold = ntt;
+			assert(m1.multiplyBigInt(m2).toString() == mulExpected);
+			assert(m2.multiplyBigInt(m1).toString() == mulExpected);
+			assert(m1.multiplyBigInt(m1).toString() == sqrExpected);
+		}
+	}
+	ThreadPool::getInstance().setThreads(oldThreads);
+	limbs::parallelThreshold = oldParallel;
+
+	limbs::karatsubaThreshold = oldKaratsuba;
+	limbs::toom3Threshold = oldToom3;
+	limbs::nttThreshold = oldNTT;
+
 	// Integer division
 
 	*a = "25";
@@ -276,6 +395,135 @@ void BigInt_test()
 	assert(((*a) / b)->toString() == "0");
 	assert(((*a) % b)->toString() == "9835485584873");
 
+	*a = std::string(2999, '9') + "8" + std::string(2999, '0') + "1";
+	*b = std::string(3000, '9');
+	assert(((*a) / b)->toString() == std::string(3000, '9'));
+	assert(((*a) % b)->toString() == "0");
+	*b = "1" + std::string(1500, '0');
+	assert(((*a) / b)->toString() == std::string(2999, '9') + "8" + std::string(1500, '0'));
+	assert(((*a) % b)->toString() == "1");
+
+	// all division algorithms give the same result
+	BigInt d1 = m1.multiplyBigInt(m2).addBigInt(BigInt("12345"));
+	size_t oldBZ = limbs::bzThreshold, oldNewton = limbs::newtonThreshold;
+
+	limbs::bzThreshold = SIZE_MAX;
+	assert(d1.divide(m2).first.toString() == m1.toString());
+	assert(d1.divide(m2).second.toString() == "12345");
+	limbs::bzThreshold = 8;
+	limbs::newtonThreshold = SIZE_MAX;
+	assert(d1.divide(m2).first.toString() == m1.toString());
+	assert(d1.divide(m1).second.toString() == "12345");
+	limbs::newtonThreshold = 8;
+	assert(d1.divide(m2).first.toString() == m1.toString());
+	assert(d1.divide(m1).second.toString() == "12345");
+
+	limbs::bzThreshold = oldBZ;
+	limbs::newtonThreshold = oldNewton;
+
+	// gcd(10^n - 1, 10^k - 1) = 10^gcd(n, k) - 1 with Lehmer's algorithm and half-GCD
+	BigInt r1(std::string(3000, '9')), r2(std::string(1800, '9')), gcd, cof, inv;
+	size_t oldHgcd = limbs::hgcdThreshold;
+
+	for (size_t threshold : { SIZE_MAX, (size_t)8 })
+	{
+		limbs::hgcdThreshold = threshold;
+
+		BigInt::gcdInto(gcd, r1, r2);
+		assert(gcd.toString() == std::string(600, '9'));
+		BigInt::gcdExtInto(gcd, cof, r2, r1);
+		assert(cof.multiplyBigInt(r2).divide(r1).second.isAbsEqual(gcd));
+		BigInt::lcmInto(gcd, r1, r2);
+		assert(gcd.multiplyBigInt(BigInt(std::string(600, '9'))).toString() == r1.multiplyBigInt(r2).toString());
+	}
+
+	limbs::hgcdThreshold = oldHgcd;
+
+	BigInt::modInvInto(inv, r2, BigInt("1" + std::string(3000, '0')));
+	assert(inv.multiplyBigInt(r2).divide(BigInt("1" + std::string(3000, '0'))).second.toString() == "1");
+
+	// Barrett's reduction by cached reciprocal gives the same reminder as division
+	BigInt square = r1.multiplyBigInt(r1).addBigInt(BigInt(12345u)), rem;
+	size_t oldBarrett = limbs::barrettThreshold;
+
+	for (size_t threshold : { (size_t)1, oldBarrett })
+	{
+		limbs::barrettThreshold = threshold;
+
+		BigInt::barrettReciprocalInto(inv, r2);
+		BigInt::modBarrettInto(rem, square, r2, inv);
+		assert(rem.isAbsEqual(square.divide(r2).second));
+		BigInt::modBarrettInto(rem, BigInt(0u).subBigInt(square), r2, inv);
+		assert(rem.toString() == BigInt(0u).subBigInt(square).divide(r2).second.toString());
+	}
+
+	limbs::barrettThreshold = oldBarrett;
+
+	// roots of exact powers and of numbers just below them
+	BigInt root, pow10("1" + std::string(1500, '0')), cube;
+	BigInt::sqrtInto(root, pow10.multiplyBigInt(pow10));
+	assert(root.isAbsEqual(pow10));
+	BigInt::sqrtInto(root, pow10.multiplyBigInt(pow10).subBigInt(BigInt(1u)));
+	assert(root.toString() == std::string(1500, '9'));
+	BigInt::powInto(cube, r2, 3);
+	BigInt::rootInto(root, cube, BigInt(3u));
+	assert(root.isAbsEqual(r2));
+	BigInt::rootInto(root, cube.subBigInt(BigInt(1u)), BigInt(3u));
+	assert(root.toString() == std::string(1799, '9') + "8");
+
+	// factorial by prime factorization is the same as chain of multiplications,
+	// binomial coefficient is the same as ratio of factorials
+	BigInt chain(1u), fact1000, fact500, binom;
+	for (uint32_t i = 2; i <= 1000; i++)
+		chain.mulLimbInPlace(i);
+	BigInt::factorialInto(fact1000, BigInt(1000u));
+	assert(fact1000.isAbsEqual(chain));
+	BigInt::factorialInto(fact500, BigInt(500u));
+	BigInt::binomialInto(binom, BigInt(1000u), BigInt(500u));
+	assert(binom.multiplyBigInt(fact500).multiplyBigInt(fact500).isAbsEqual(fact1000));
+	BigInt::binomialInto(binom, BigInt("100000000000000000000"), BigInt(3u));
+	assert(binom.toString() == "166666666666666666661666666666666666666700000000000000000000");
+
+	// fast doubling gives the same Fibonacci numbers as additions,
+	// Lucas numbers satisfy L(n)^2 - 5 * F(n)^2 = 4 * (-1)^n
+	BigInt fib0, fib1(1u), fib, lucas;
+	for (int i = 0; i < 1000; i++)
+	{
+		fib0.addInPlace(fib1);
+		std::swap(fib0, fib1);
+	}
+	BigInt::fibonacciInto(fib, BigInt(1000u));
+	assert(fib.isAbsEqual(fib0));
+	BigInt::fibonacciInto(fib, BigInt(10001u));
+	BigInt::lucasInto(lucas, BigInt(10001u));
+	assert((lucas.multiplyBigInt(lucas).subBigInt(fib.multiplyBigInt(fib).multiplyBigInt(BigInt(5u)))).toString() == "-4");
+
+	// strong pseudoprime to bases up to 23 and Lucas pseudoprime are rejected
+	BigInt prime;
+	assert(BigInt::isPrime(BigInt("170141183460469231731687303715884105727")));
+	assert(!BigInt::isPrime(BigInt("3825123056546413051")));
+	assert(!BigInt::isPrime(BigInt(5459u)));
+	assert(!BigInt::isPrime(BigInt("318665857834031151167461")));
+	BigInt::nextPrimeInto(prime, BigInt("1" + std::string(100, '0')));
+	assert(prime.toString() == "1" + std::string(97, '0') + "267");
+
+	// all kernel sets give the same result, the best one stays selected after the loop
+	for (kernels::Isa isa : { kernels::Isa::scalar, kernels::Isa::avx2, kernels::Isa::avx512 })
+	{
+		if (!kernels::select(isa))
+			continue;
+
+		assert(m1.multiplyBigInt(m2).toString() == mulExpected);
+		assert(d1.divide(m2).first.isAbsEqual(m1));
+		assert(d1.subBigInt(m1.multiplyBigInt(m2)).toString() == "12345");
+		assert(m2.absLessThan(m1) && !m1.absLessThan(m1));
+	}
+
+	*a = "0";
+	*b = "-7549361937528593750956";
+	assert(((*a) / b)->toString() == "0");
+	assert(((*a) % b)->toString() == "0");
+
 	try
 	{
 		a = (*a) / std::shared_ptr<IBigNum>(new BigInt(0u));
@@ -322,6 +570,72 @@ void BigInt_test()
 
 	BigInt d("-0");
 
+	// in-place operations, where result is also an operand
+	BigInt e("-18446744073709551615");
+	e.addInPlace(e);
+	assert(e.toString() == "-36893488147419103230");
+	e -= BigInt("-36893488147419103231");
+	assert(e.toString() == "1");
+	e = BigInt("340282366920938463463374607431768211456");
+	e *= e;
+	assert(e.toString() == "115792089237316195423570985008687907853269984665640564039457584007913129639936");
+	BigInt::mulInto(e, e, BigInt("-1"));
+	assert(e.toString(true)[0] == '-');
+
+	BigInt f("-7"), g("2");
+	BigInt::divmodInto(f, g, f, g);
+	assert(f.toString() == "-4" && g.toString() == "1");
+	BigInt::subInto(f, g, g);
+	assert(f.toString(true) == "0");
+
+	BigInt h(std::move(e));
+	e = std::move(h);
+	assert(e.isAbsEqual(BigInt("115792089237316195423570985008687907853269984665640564039457584007913129639936")));
+
+	// shifts by whole limbs and by bits inside limb
+	BigInt s1("123456789012345678901234567890");
+	s1.shiftLeft(200);
+	s1.shiftRight(137);
+	assert(s1.toString() == "1138687895536349070124195419011280854005705605120");
+	s1.shiftRight(1000);
+	assert(s1.toString() == "0");
+	s1 = BigInt("-5");
+	s1.shiftRight(1);
+	assert(s1.toString() == "-3");
+	s1.shiftLeft(128);
+	assert(s1.toString() == "-1020847100762815390390123822295304634368");
+
+	// bitwise operations with two's complement of negative numbers
+	BigInt w1("-340282366920938463463374607431768211456"), w2("18446744073709551617");
+	assert(w1.andBigInt(w2).toString() == "0");
+	assert(w1.orBigInt(w2).toString() == "-340282366920938463444927863358058659839");
+	assert(w1.xorBigInt(w2).toString() == "-340282366920938463444927863358058659839");
+	assert(w2.notBigInt().toString() == "-18446744073709551618");
+	assert(BigInt("-12").andBigInt(BigInt("-10")).toString() == "-12");
+	assert(BigInt("-12").orBigInt(BigInt("10")).toString() == "-2");
+	assert(BigInt("-1").notBigInt().toString(true) == "0");
+
+	// powers with windows of different sizes
+	assert(BigInt("-3").powerBigInt(BigInt("5")).toString() == "-243");
+	assert(BigInt("7").powerBigInt(BigInt("0")).toString() == "1");
+	BigInt p1("123456789");
+	assert(p1.powerBigInt(BigInt("1000")).isAbsEqual(p1.powerBigInt(BigInt("999")).multiplyBigInt(p1)));
+	BigInt p2(1u);
+	p2.shiftLeft(33554431);
+	assert(BigInt("2").powerBigInt(BigInt("33554431")).isAbsEqual(p2));
+
+	// long powers of ten come from cache, zeros are stripped by powers 5^(2^i)
+	BigInt scaled;
+	BigInt::mulPow10Into(scaled, BigInt("-37"), 5000);
+	assert(scaled.toString() == "-37" + std::string(5000, '0'));
+	BigInt::mulPow10Into(scaled, scaled, 30);
+	assert(scaled.toString() == "-37" + std::string(5030, '0'));
+	assert(scaled.stripPow10(5100) == 5030 && scaled.toString() == "-37");
+	BigInt::mulPow10Into(scaled, BigInt("250"), 1000);
+	assert(scaled.stripPow10(777) == 777 && scaled.toString() == "250" + std::string(223, '0'));
+	assert(scaled.stripPow10(SIZE_MAX) == 224 && scaled.toString() == "25");
+	assert(scaled.stripPow10(SIZE_MAX) == 0 && scaled.toString() == "25");
+
 	std::cout << "BigInt test finished successful" << std::endl;
 }
 
@@ -440,6 +754,43 @@ void BigDouble_test()
 	*b = "1.12";
 	assert(((*a) * b)->toString(true) == "1.2544");
 
+	// quotient is cut off after given count of fractional digits, reminder is exact
+	*a = "10.5";
+	*b = "4";
+	assert(((*a) / b)->toString() == "2.625");
+
+	*a = "-1";
+	*b = "3.0";
+	assert(((*a) / b)->toString() == "-0." + std::string(BigDouble::DEFAULT_PRECISION, '3'));
+	assert(dynamic_cast<BigDouble*>(a.get())->divide(b, 3)->toString() == "-0.333");
+	assert(dynamic_cast<BigDouble*>(a.get())->divide(b, 0)->toString() == "0");
+
+	*a = "7.5";
+	*b = "2.5";
+	assert(((*a) / b)->toString() == "3");
+
+	*b = "2";
+	assert(((*a) % b)->toString() == "1.5");
+
+	*b = "-2";
+	assert(((*a) % b)->toString() == "-0.5");
+
+	*a = "-7.5";
+	*b = "2";
+	assert(((*a) % b)->toString() == "0.5");
+
+	*a = "123.456";
+	*b = "0.1";
+	assert(((*a) % b)->toString() == "0.056");
+
+	// alignment by thousands of digits and removal of thousands of zeros
+	*a = "0." + std::string(4999, '0') + "1";
+	*b = "3";
+	assert(((*a) + b)->toString() == "3." + std::string(4999, '0') + "1");
+	assert(((*((*a) + b)) - b)->toString() == a->toString());
+	*b = "1" + std::string(5000, '0');
+	assert(((*a) * b)->toString() == "1");
+
 	std::cout << "BigDouble test finished successful" << std::endl;
 }
 
@@ -472,6 +823,13 @@ void BigNumber_test()
 	a = (*a) - /*(*c) * b*/d;
 	assert(a->toString() == "9.5");
 
+	a.reset(new BigInt("24"));
+	assert(((*a) / b)->toString() == "48");
+	assert(((*c) % b)->toString() == "0");
+	b.reset(new BigDouble("0.3"));
+	assert(((*c) % b)->toString() == "0.2");
+	b.reset(new BigDouble("0.5"));
+
 	a.reset(new BigInt("23089367583674934536092"));
 	a = *((*a) % c) + (*a) * b;
 	assert(a->toString() == "11544683791837467268048");
@@ -521,15 +879,48 @@ void Evaluator_test()
 	assert(Evaluator::getInstance().Evaluate("2 + 5 * 7 - 3 * 89 + 0.5)", error) == "Missing an open bracket!!!");
 	//std::cout << Evaluator::getInstance().Evaluate("2 + pi * 7 - 2 * (89 + 0.5)") << std::endl;
 	assert(Evaluator::getInstance().Evaluate("2 + pi * 7 - 2 * (89 + 0.5)", error) == "-155.0088514248714476");
-	assert(Evaluator::getInstance().Evaluate("2 + pi * 7 ^ x * (89 + 0.5)", error) == "Incorrect symbol!!!");
+	assert(Evaluator::getInstance().Evaluate("2 + pi * 7 # x * (89 + 0.5)", error) == "Incorrect symbol!!!");
+	assert(Evaluator::getInstance().Evaluate("6 | 1 ^ 3 & 2 << 1", error) == "7");
+	assert(Evaluator::getInstance().Evaluate("~~5 & ~(2 - 4)", error) == "1");
+	assert(Evaluator::getInstance().Evaluate("~", error) == "Incorrect expression!!!");
+	assert(Evaluator::getInstance().Evaluate("~ + 2", error) == "Incorrect expression!!!");
+	assert(Evaluator::getInstance().Evaluate("3 ~ 2", error) == "Missing operation!!!");
+	assert(Evaluator::getInstance().Evaluate("pi ^ 3", error) == "Bitwise operations are not defined for BigDouble!!!");
 	assert(Evaluator::getInstance().Evaluate("2 + pi * 7 + x * (89 + 0.5)", error) == "Unknown variable!!!");
-	assert(Evaluator::getInstance().Evaluate("10.5 / 3", error) == "Division is not defined for BigDouble!!!");
+	assert(Evaluator::getInstance().Evaluate("1 << 2 + 3 * 2", error) == "256");
+	assert(Evaluator::getInstance().Evaluate("1 < 2", error) == "Incorrect symbol!!!");
+	assert(Evaluator::getInstance().Evaluate("1 << - 2", error) == "Negative shift count!!!");
+	assert(Evaluator::getInstance().Evaluate("5 >> 100000000000", error) == "0");
+	assert(Evaluator::getInstance().Evaluate("(0 - 5) >> 100000000000000000000000", error) == "-1");
+	assert(Evaluator::getInstance().Evaluate("1 << 100000000000", error) == "Too big shift count!!!");
+	assert(Evaluator::getInstance().Evaluate("1.5 >> 2", error) == "Shift is not defined for BigDouble!!!");
+	assert(Evaluator::getInstance().Evaluate("10.5 / 3", error) == "3.5");
+	assert(Evaluator::getInstance().Evaluate("10 / 3", error) == "3");
+	assert(Evaluator::getInstance().Evaluate("1.5 / 0", error) == "Division by zero!!!");
+	assert(Evaluator::getInstance().Evaluate("1.5 % 0", error) == "Division by zero!!!");
+	Evaluator::getInstance().setPrecision(5);
+	assert(Evaluator::getInstance().Evaluate("2 / 3.0", error) == "0.66666");
+	assert(Evaluator::getInstance().Evaluate("2 / 0.00003", error) == "66666.66666");
+	Evaluator::getInstance().setPrecision(BigDouble::DEFAULT_PRECISION);
 
 	assert(Evaluator::getInstance().Evaluate("x=23+34", error) == "");
 	assert(Evaluator::getInstance().Evaluate("x % 5", error) == "2");
 	assert(Evaluator::getInstance().Evaluate("x = 5", error) == "");
 	assert(Evaluator::getInstance().Evaluate("x", error) == "5");
 
+	// reciprocal of variable m is cached and dropped, when m is assigned
+	assert(Evaluator::getInstance().Evaluate("m = 10 ** 1300 + 7", error) == "");
+	assert(Evaluator::getInstance().Evaluate("x = m * 3 + 5", error) == "");
+	assert(Evaluator::getInstance().Evaluate("x % m", error) == "5");
+	assert(Evaluator::getInstance().Evaluate("x * x % m", error) == "25");
+	assert(Evaluator::getInstance().Evaluate("y = 0 - x", error) == "");
+	assert(Evaluator::getInstance().Evaluate("y % m - m", error) == "-5");
+	assert(Evaluator::getInstance().Evaluate("m = 7", error) == "");
+	assert(Evaluator::getInstance().Evaluate("x % m", error) == "3");
+	assert(Evaluator::getInstance().Evaluate("m = 0.5", error) == "");
+	assert(Evaluator::getInstance().Evaluate("x % m", error) == "0");
+	assert(Evaluator::getInstance().Evaluate("(x + 0.75) % m", error) == "0.25");
+
 	assert(Evaluator::getInstance().Evaluate("y/=34 -54", error) == "Incorrect variable name!!!");
 	assert(Evaluator::getInstance().Evaluate("2y=34 -54", error) == "Incorrect variable name!!!");
 	assert(Evaluator::getInstance().Evaluate("y,,=34 -54", error) == "Incorrect variable name!!!");
@@ -541,6 +932,58 @@ void Evaluator_test()
 
 	Evaluator::getInstance().Evaluate("10 - - 2", error);
 
+	assert(Evaluator::getInstance().Evaluate("2 ** 3 ** 2", error) == "512");
+	assert(Evaluator::getInstance().Evaluate("2 * 3 ** 2 - 1", error) == "17");
+	assert(Evaluator::getInstance().Evaluate("1.5 ** 3", error) == "3.375");
+	assert(Evaluator::getInstance().Evaluate("0.1 ** 3 + 0.2 ** 0", error) == "1.001");
+	assert(Evaluator::getInstance().Evaluate("(0 - 1) ** 100000000000000000001", error) == "-1");
+	assert(Evaluator::getInstance().Evaluate("-2 ** 2", error) == "-4");
+	assert(Evaluator::getInstance().Evaluate("- 2 ** 2", error) == "-4");
+	assert(Evaluator::getInstance().Evaluate("2 * -3 ** 2", error) == "-18");
+	assert(Evaluator::getInstance().Evaluate("~3 ** 2", error) == "-10");
+	assert(Evaluator::getInstance().Evaluate("2 ** ~1 ** 2 + (-3) ** 2", error) == "Negative exponent!!!");
+	assert(Evaluator::getInstance().Evaluate("(-3) ** 2 - ~1 * 2", error) == "13");
+	assert(Evaluator::getInstance().Evaluate("(2.5 * 0.4) << 1", error) == "2");
+	assert(Evaluator::getInstance().Evaluate("(2.5 * 0.4) & 1", error) == "1");
+	assert(Evaluator::getInstance().Evaluate("2 ** (2.5 * 0.4)", error) == "2");
+	assert(Evaluator::getInstance().Evaluate("fact(2.5 * 1.2)", error) == "6");
+	assert(Evaluator::getInstance().Evaluate("2 ** 0.5", error) == "Exponent must be integer!!!");
+	assert(Evaluator::getInstance().Evaluate("2 ** - 1", error) == "Negative exponent!!!");
+	assert(Evaluator::getInstance().Evaluate("2 ** 100000000000", error) == "Too big exponent!!!");
+
+	assert(Evaluator::getInstance().Evaluate("gcd(-12, 18)", error) == "6");
+	assert(Evaluator::getInstance().Evaluate("gcd(0, 0) + lcm(0, 5)", error) == "0");
+	assert(Evaluator::getInstance().Evaluate("lcm(-4, 6)", error) == "12");
+	assert(Evaluator::getInstance().Evaluate("modinv(3, 7)", error) == "5");
+	assert(Evaluator::getInstance().Evaluate("modinv(-3, -7)", error) == "-5");
+	assert(Evaluator::getInstance().Evaluate("modinv(6, 9)", error) == "Modular inverse doesn't exist!!!");
+	assert(Evaluator::getInstance().Evaluate("modinv(3, 0)", error) == "Division by zero!!!");
+	assert(Evaluator::getInstance().Evaluate("isqrt(99) + isqrt(0)", error) == "9");
+	assert(Evaluator::getInstance().Evaluate("iroot(-28, 3)", error) == "-3");
+	assert(Evaluator::getInstance().Evaluate("iroot(5, 100)", error) == "1");
+	assert(Evaluator::getInstance().Evaluate("isqrt(-4)", error) == "Even root of negative number!!!");
+	assert(Evaluator::getInstance().Evaluate("iroot(8, 0)", error) == "Root degree must be positive!!!");
+	assert(Evaluator::getInstance().Evaluate("fact(20) + fact(0)", error) == "2432902008176640001");
+	assert(Evaluator::getInstance().Evaluate("binom(52, 5) + binom(5, 7) + binom(5, -1)", error) == "2598960");
+	assert(Evaluator::getInstance().Evaluate("binom(-4, 3)", error) == "-20");
+	assert(Evaluator::getInstance().Evaluate("fact(-1)", error) == "Factorial of negative number!!!");
+	assert(Evaluator::getInstance().Evaluate("fact(10000000000)", error) == "Too big argument of factorial!!!");
+	assert(Evaluator::getInstance().Evaluate("fib(0) + fib(1) + fib(90)", error) == "2880067194370816121");
+	assert(Evaluator::getInstance().Evaluate("fib(-8)", error) == "-21");
+	assert(Evaluator::getInstance().Evaluate("lucas(0) + lucas(1) + lucas(-5)", error) == "-8");
+	assert(Evaluator::getInstance().Evaluate("fib(10000000000)", error) == "Too big index of Fibonacci number!!!");
+	assert(Evaluator::getInstance().Evaluate("isprime(97) + isprime(91) + isprime(1) + isprime(-7)", error) == "1");
+	assert(Evaluator::getInstance().Evaluate("nextprime(-10) + nextprime(13)", error) == "19");
+	assert(Evaluator::getInstance().Evaluate("powmod(4, 13, 497)", error) == "445");
+	assert(Evaluator::getInstance().Evaluate("powmod(2, 100, 1000000) + powmod(-3, 3, 7) * (-2)", error) == "205374");
+	assert(Evaluator::getInstance().Evaluate("powmod(5, 3, -7)", error) == "-1");
+	assert(Evaluator::getInstance().Evaluate("powmod(2, 10)", error) == "Incorrect count of arguments!!!");
+	assert(Evaluator::getInstance().Evaluate("powmod(2, 10, 0)", error) == "Division by zero!!!");
+	assert(Evaluator::getInstance().Evaluate("powmod(2, 0.5, 7)", error) == "Function powmod is defined only for integers!!!");
+	assert(Evaluator::getInstance().Evaluate("powmod(2,, 7)", error) == "Incorrect expression!!!");
+	assert(Evaluator::getInstance().Evaluate("1, 2", error) == "Comma outside of function!!!");
+	assert(Evaluator::getInstance().Evaluate("powmod = 2", error) == "Prohibited variable name!!!");
+
 	std::cout << "Evaluator test finished successful" << std::endl;
 }
 #endif
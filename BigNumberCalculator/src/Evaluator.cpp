@@ -9,6 +9,22 @@ void Evaluator::initConstants()
 	constants.emplace("e", makeBigNum("2.7182818284590452"));
 }
 
+void Evaluator::initFunctions()
+{
+	functions.emplace("powmod", 3);
+	functions.emplace("gcd", 2);
+	functions.emplace("lcm", 2);
+	functions.emplace("modinv", 2);
+	functions.emplace("isqrt", 1);
+	functions.emplace("iroot", 2);
+	functions.emplace("fact", 1);
+	functions.emplace("binom", 2);
+	functions.emplace("fib", 1);
+	functions.emplace("lucas", 1);
+	functions.emplace("isprime", 1);
+	functions.emplace("nextprime", 1);
+}
+
 std::string Evaluator::checkVarName(std::string& name) const
 {
 	while (!name.empty() && isspace(name[0]))
@@ -17,7 +33,7 @@ std::string Evaluator::checkVarName(std::string& name) const
 	while (!name.empty() && isspace(name.back()))
 		name.erase(name.size() - 1);
 
-	if (name.find_first_of(" \n\t/*()+-") != std::string::npos ||
+	if (name.find_first_of(" \n\t/*()+-<>&|^~,") != std::string::npos ||
 		name.empty() ||
 		isdigit(name[0]))
 		return "Incorrect variable name!!!";
@@ -30,7 +46,8 @@ std::string Evaluator::checkVarName(std::string& name) const
 		if (nm == name)
 			return "Prohibited variable name!!!";
 
-	if (constants.find(name) != constants.end())
+	if (constants.find(name) != constants.end() ||
+		functions.find(name) != functions.end())
 		return "Prohibited variable name!!!";
 
 	return "";
@@ -46,6 +63,13 @@ bool Evaluator::checkSymbol(const char symb) const
 		symb != '/' &&
 		symb != '%' &&
 		symb != '*' &&
+		symb != '<' &&
+		symb != '>' &&
+		symb != '&' &&
+		symb != '|' &&
+		symb != '^' &&
+		symb != '~' &&
+		symb != ',' &&
 		symb != '(' &&
 		symb != ')')
 		return false;
@@ -61,12 +85,11 @@ std::pair<std::string, Evaluator::TokenType> Evaluator::readToken(const std::str
 	if (!checkSymbol(str[iter]))
 		return { "Incorrect symbol!!!", Evaluator::TokenType::error };
 
-	bool firstNegNum = false;
+	// minus at the beginning is sign, which is applied after power
 	if (iter == start && str[iter] == '-')
 	{
-		firstNegNum = true;
 		iter++;
-		while (isspace(str[iter])) iter++;
+		return { "-", Evaluator::TokenType::unaryOperation };
 	}
 
 	size_t dotsCount = 0;
@@ -79,17 +102,42 @@ std::pair<std::string, Evaluator::TokenType> Evaluator::readToken(const std::str
 	case '*':
 	case '/':
 	case '%':
+	case '&':
+	case '|':
+	case '^':
 		if (iter == start)
 			return { "Missing operand!!!", Evaluator::TokenType::error };
 
+		// power is written as doubled multiplication
+		if (str[iter] == '*' && iter + 1 < str.size() && str[iter + 1] == '*')
+			op.push_back(str[iter++]);
+
 		op.push_back(str[iter++]);
 		return { op, Evaluator::TokenType::operation };
+	case '~':
+		iter++;
+		return { "~", Evaluator::TokenType::unaryOperation };
+	case '<':
+	case '>':
+		if (iter == start)
+			return { "Missing operand!!!", Evaluator::TokenType::error };
+
+		// shifts are written with doubled symbol
+		if (iter + 1 >= str.size() || str[iter + 1] != str[iter])
+			return { "Incorrect symbol!!!", Evaluator::TokenType::error };
+
+		op = str.substr(iter, 2);
+		iter += 2;
+		return { op, Evaluator::TokenType::operation };
 	case '(':
 		iter++;
 		return { "(", Evaluator::TokenType::openBracket };
 	case ')':
 		iter++;
 		return { ")", Evaluator::TokenType::closeBracket };
+	case ',':
+		iter++;
+		return { ",", Evaluator::TokenType::separator };
 	case'0':
 	case'1':
 	case'2':
@@ -100,9 +148,6 @@ std::pair<std::string, Evaluator::TokenType> Evaluator::readToken(const std::str
 	case'7':
 	case'8':
 	case'9':
-		if (firstNegNum)
-			numb.push_back('-');
-
 		for (; iter < str.size(); iter++)
 		{
 			if (str[iter] == '.') dotsCount++;
@@ -118,6 +163,12 @@ std::pair<std::string, Evaluator::TokenType> Evaluator::readToken(const std::str
 					str[iter] != '*' &&
 					str[iter] != '/' &&
 					str[iter] != '%' &&
+					str[iter] != '<' &&
+					str[iter] != '>' &&
+					str[iter] != '&' &&
+					str[iter] != '|' &&
+					str[iter] != '^' &&
+					str[iter] != ',' &&
 					str[iter] != ')' &&
 					!isspace(str[iter]))
 					return { "Incorrect number!!!", Evaluator::TokenType::error };
@@ -142,6 +193,17 @@ std::pair<std::string, Evaluator::TokenType> Evaluator::readToken(const std::str
 		if (constants.find(sth) != constants.end())
 			return { sth, Evaluator::TokenType::constant };
 
+		// function name is followed by its arguments in brackets
+		if (functions.find(sth) != functions.end())
+		{
+			size_t next = iter;
+			while (next < str.size() && isspace(str[next]))
+				next++;
+
+			if (next < str.size() && str[next] == '(')
+				return { sth, Evaluator::TokenType::function };
+		}
+
 		return { sth, Evaluator::TokenType::variable };
 	}
 
@@ -150,9 +212,19 @@ std::pair<std::string, Evaluator::TokenType> Evaluator::readToken(const std::str
 
 int Evaluator::getOperatorPriority(const std::string& op) const
 {
+	if (op == "**")
+		return 7;
 	if (op == "/" || op == "*" || op == "%")
-		return 2;
+		return 6;
 	if (op == "+" || op == "-")
+		return 5;
+	if (op == "<<" || op == ">>")
+		return 4;
+	if (op == "&")
+		return 3;
+	if (op == "^")
+		return 2;
+	if (op == "|")
 		return 1;
 	return 0;
 }
@@ -178,19 +250,105 @@ IBigNum_ptr Evaluator::compute(IBigNum_ptr num1, IBigNum_ptr num2,const std::str
 	else if (op == "*")
 		return (*num1) * num2;
 	else if (op == "/")
-		return (*num1) / num2;
+	{
+		// quotient of big doubles gets digits by current precision
+		if (const BigDouble* a = dynamic_cast<const BigDouble*>(num1.get()))
+			return a->divide(num2, precision);
+		else if (dynamic_cast<const BigDouble*>(num2.get()))
+			return BigDouble(*dynamic_cast<const BigInt*>(num1.get()), 0).divide(num2, precision);
+		else
+			return (*num1) / num2;
+	}
 	else if (op == "%")
 		return (*num1) % num2;
+	else if (op == "**")
+		return num1->power(num2);
+	else if (op == "<<")
+		return (*num1) << num2;
+	else if (op == ">>")
+		return (*num1) >> num2;
+	else if (op == "&")
+		return (*num1) & num2;
+	else if (op == "|")
+		return (*num1) | num2;
+	else if (op == "^")
+		return (*num1) ^ num2;
 
 	return IBigNum_ptr();
 }
 
+IBigNum_ptr Evaluator::computeMod(IBigNum_ptr num1, IBigNum_ptr num2, const std::string& varName)
+{
+	const BigInt* a = dynamic_cast<const BigInt*>(num1.get());
+	const BigInt* m = dynamic_cast<const BigInt*>(num2.get());
+	if (!a || !m)
+		return compute(num1, num2, "%");
+
+	auto it = moduli.find(varName);
+	if (it == moduli.end() || it->second.modulus != num2)
+	{
+		CachedModulus entry;
+		entry.modulus = num2;
+		BigInt::barrettReciprocalInto(entry.reciprocal, *m);
+		it = moduli.insert_or_assign(varName, std::move(entry)).first;
+	}
+
+	std::shared_ptr<BigInt> res = std::make_shared<BigInt>();
+	BigInt::modBarrettInto(*res, *a, *m, it->second.reciprocal);
+	return res;
+}
+
+IBigNum_ptr Evaluator::callFunction(const std::string& name, const std::vector<IBigNum_ptr>& args)
+{
+	// all built-in functions work with integers
+	std::vector<const BigInt*> ints;
+	for (auto& arg : args)
+	{
+		const BigInt* num = dynamic_cast<const BigInt*>(arg.get());
+		if (!num)
+			throw std::runtime_error("Function " + name + " is defined only for integers!!!");
+
+		ints.push_back(num);
+	}
+
+	std::shared_ptr<BigInt> res = std::make_shared<BigInt>();
+
+	if (name == "powmod")
+		BigInt::powModInto(*res, *ints[0], *ints[1], *ints[2]);
+	else if (name == "gcd")
+		BigInt::gcdInto(*res, *ints[0], *ints[1]);
+	else if (name == "lcm")
+		BigInt::lcmInto(*res, *ints[0], *ints[1]);
+	else if (name == "modinv")
+		BigInt::modInvInto(*res, *ints[0], *ints[1]);
+	else if (name == "isqrt")
+		BigInt::sqrtInto(*res, *ints[0]);
+	else if (name == "iroot")
+		BigInt::rootInto(*res, *ints[0], *ints[1]);
+	else if (name == "fact")
+		BigInt::factorialInto(*res, *ints[0]);
+	else if (name == "binom")
+		BigInt::binomialInto(*res, *ints[0], *ints[1]);
+	else if (name == "fib")
+		BigInt::fibonacciInto(*res, *ints[0]);
+	else if (name == "lucas")
+		BigInt::lucasInto(*res, *ints[0]);
+	else if (name == "isprime")
+		*res = BigInt(BigInt::isPrime(*ints[0]) ? 1u : 0u);
+	else if (name == "nextprime")
+		BigInt::nextPrimeInto(*res, *ints[0]);
+
+	return res;
+}
+
 std::string Evaluator::makeRPN(const std::string& str)
 {
 	int count = 0;
 	bool lastOperand = false;
 	bool firstSpaceCutting = true;
 	bool firstStep = true;
+	bool lastUnary = false;
+	bool lastFunction = false;
 
 	// Shunting Yard algorithm
 	while (true)
@@ -207,6 +365,8 @@ std::string Evaluator::makeRPN(const std::string& str)
 
 		if (firstStep &&
 			token.second != Evaluator::TokenType::openBracket &&
+			token.second != Evaluator::TokenType::unaryOperation &&
+			token.second != Evaluator::TokenType::function &&
 			token.second != Evaluator::TokenType::variable &&
 			token.second != Evaluator::TokenType::constant &&
 			token.second != Evaluator::TokenType::number)
@@ -216,6 +376,21 @@ std::string Evaluator::makeRPN(const std::string& str)
 		}
 		firstStep = false;
 
+		// unary operation needs an operand right after it
+		if (lastUnary &&
+			(token.first.empty() ||
+			token.second == Evaluator::TokenType::operation ||
+			token.second == Evaluator::TokenType::separator ||
+			token.second == Evaluator::TokenType::closeBracket))
+		{
+			reset();
+			return "Incorrect expression!!!";
+		}
+		lastUnary = token.second == Evaluator::TokenType::unaryOperation;
+
+		bool functionBracket = lastFunction;
+		lastFunction = token.second == Evaluator::TokenType::function;
+
 		if (token.first.empty())
 		{
 			if (count)
@@ -243,6 +418,7 @@ std::string Evaluator::makeRPN(const std::string& str)
 		if (lastOperand &&
 			token.second != Evaluator::TokenType::closeBracket &&
 			token.second != Evaluator::TokenType::operation &&
+			token.second != Evaluator::TokenType::separator &&
 			token.second != Evaluator::TokenType::error)
 		{
 			reset();
@@ -263,18 +439,54 @@ std::string Evaluator::makeRPN(const std::string& str)
 			lastOperand = true;
 			break;
 		case Evaluator::TokenType::number:
+			// minus after operation becomes sign of number
 			if (count == 2)
-			{
-				funcStack.pop();
-				token.first.insert(0, "-");
-			}
+				funcStack.top().second = Evaluator::TokenType::unaryOperation;
 			outputQ.push(token);
 			count = 0;
 			lastOperand = true;
 			break;
+		case Evaluator::TokenType::unaryOperation:
+			if (count == 2)
+			{
+				reset();
+				return "Incorrect expression!!!";
+			}
+			funcStack.push(token);
+			break;
 		case Evaluator::TokenType::function:
+			if (count == 2)
+			{
+				reset();
+				return "Incorrect expression!!!";
+			}
+			funcStack.push(token);
+			break;
 		case Evaluator::TokenType::openBracket:
 			funcStack.push(token);
+			argCounts.push(functionBracket ? 1 : 0);
+			break;
+		case Evaluator::TokenType::separator:
+			if (count || !lastOperand)
+			{
+				reset();
+				return "Incorrect expression!!!";
+			}
+
+			if (argCounts.empty() || !argCounts.top())
+			{
+				reset();
+				return "Comma outside of function!!!";
+			}
+
+			while (funcStack.top().second != Evaluator::TokenType::openBracket)
+			{
+				outputQ.push(funcStack.top());
+				funcStack.pop();
+			}
+
+			argCounts.top()++;
+			lastOperand = false;
 			break;
 		case Evaluator::TokenType::operation:
 			if (count == 1 && token.first != "-")
@@ -283,9 +495,17 @@ std::string Evaluator::makeRPN(const std::string& str)
 				return "Incorrect expression!!!";
 			}
 
+			// minus right after open bracket or comma is sign of number
+			if (count == 0 && !lastOperand && token.first == "-")
+				count++;
+
+			// power is right associative, so it doesn't pop another power,
+			// and it binds tighter than unary operations before its base
 			while (!funcStack.empty() && count == 0 &&
-				funcStack.top().second == Evaluator::TokenType::operation &&
-				getOperatorPriority(funcStack.top().first) >= getOperatorPriority(token.first))
+				((funcStack.top().second == Evaluator::TokenType::unaryOperation && token.first != "**") ||
+				(funcStack.top().second == Evaluator::TokenType::operation &&
+				(getOperatorPriority(funcStack.top().first) > getOperatorPriority(token.first) ||
+				(getOperatorPriority(funcStack.top().first) == getOperatorPriority(token.first) && token.first != "**")))))
 			{
 				outputQ.push(funcStack.top());
 				funcStack.pop();
@@ -295,7 +515,7 @@ std::string Evaluator::makeRPN(const std::string& str)
 			lastOperand = false;
 			break;
 		case Evaluator::TokenType::closeBracket:
-			if (count)
+			if (count || (!lastOperand && !funcStack.empty()))
 			{
 				reset();
 				return "Incorrect expression!!!";
@@ -328,9 +548,16 @@ std::string Evaluator::makeRPN(const std::string& str)
 			if (!funcStack.empty() &&
 				funcStack.top().second == Evaluator::TokenType::function)
 			{
+				if (functions[funcStack.top().first] != argCounts.top())
+				{
+					reset();
+					return "Incorrect count of arguments!!!";
+				}
+
 				outputQ.push(funcStack.top());
 				funcStack.pop();
 			}
+			argCounts.pop();
 			break;
 		case Evaluator::TokenType::error:
 			reset();
@@ -345,6 +572,9 @@ IBigNum_ptr Evaluator::evalRPN()
 {
 	std::stack<IBigNum_ptr> nums;
 
+	// variable, which is the previous token, so it is the right operand of operation
+	std::string lastVariable;
+
 	while (!outputQ.empty())
 	{
 		switch (outputQ.front().second)
@@ -368,13 +598,48 @@ IBigNum_ptr Evaluator::evalRPN()
 			IBigNum_ptr num1 = nums.top();
 			nums.pop();
 
-			nums.push(compute(num1, num2, outputQ.front().first));
+			if (outputQ.front().first == "%" && !lastVariable.empty())
+				nums.push(computeMod(num1, num2, lastVariable));
+			else
+				nums.push(compute(num1, num2, outputQ.front().first));
+		}
+			break;
+		case Evaluator::TokenType::function:
+		{
+			std::vector<IBigNum_ptr> args(functions[outputQ.front().first]);
+			for (size_t i = args.size(); i-- > 0;)
+			{
+				args[i] = nums.top();
+				nums.pop();
+			}
+
+			nums.push(callFunction(outputQ.front().first, args));
+		}
+			break;
+		case Evaluator::TokenType::unaryOperation:
+		{
+			IBigNum_ptr num = nums.top();
+			nums.pop();
+
+			if (outputQ.front().first == "-")
+			{
+				num = num->clone();
+				num->timesMinusOne();
+				nums.push(num);
+			}
+			else
+				nums.push(~(*num));
 		}
 			break;
 		default:
 			break;
 		}
 
+		if (outputQ.front().second == Evaluator::TokenType::variable)
+			lastVariable = outputQ.front().first;
+		else
+			lastVariable.clear();
+
 		outputQ.pop();
 	}
 
@@ -385,6 +650,7 @@ void Evaluator::reset()
 {
 	outputQ = std::queue<std::pair<std::string, Evaluator::TokenType>>();
 	funcStack = std::stack<std::pair<std::string, Evaluator::TokenType>>();
+	argCounts = std::stack<size_t>();
 	iter = 0;
 }
 
@@ -393,9 +659,13 @@ Evaluator::Evaluator()
 	iter(0)
 {
 	initConstants();
+	initFunctions();
 
 	prohibitedVarNames.push_back("cls");
 	prohibitedVarNames.push_back("test");
+	prohibitedVarNames.push_back("bench");
+	prohibitedVarNames.push_back("threads");
+	prohibitedVarNames.push_back("precision");
 	prohibitedVarNames.push_back("exit");
 	prohibitedVarNames.push_back("clv");
 	prohibitedVarNames.push_back("clh");
@@ -464,6 +734,8 @@ std::string Evaluator::Evaluate(const std::string& str, bool& isError)
 		else
 			variables.emplace(varName, res);
 
+		moduli.erase(varName);
+
 		return "";
 	}
 	else
@@ -483,4 +755,5 @@ std::list<std::pair<std::string, IBigNum_ptr>> Evaluator::getAllVars() const
 void Evaluator::clearAllVars()
 {
 	variables.clear();
+	moduli.clear();
 }
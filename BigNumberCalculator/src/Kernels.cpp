@@ -0,0 +1,129 @@
+#include "../hdrs/Kernels.h"
+
+#if defined(KERNELS_X86) && defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+namespace
+{
+	int cmpScalar(const limb_t* a, const limb_t* b, size_t n)
+	{
+		while (n-- > 0)
+		{
+			if (a[n] != b[n])
+				return a[n] < b[n] ? -1 : 1;
+		}
+
+		return 0;
+	}
+
+	limb_t addNScalar(limb_t* r, const limb_t* a, const limb_t* b, size_t n)
+	{
+		limb_t carry = 0;
+		for (size_t i = 0; i < n; i++)
+			r[i] = limbs::addCarry(a[i], b[i], carry);
+
+		return carry;
+	}
+
+	limb_t subNScalar(limb_t* r, const limb_t* a, const limb_t* b, size_t n)
+	{
+		limb_t borrow = 0;
+		for (size_t i = 0; i < n; i++)
+			r[i] = limbs::subBorrow(a[i], b[i], borrow);
+
+		return borrow;
+	}
+
+	limb_t addMul1Scalar(limb_t* r, const limb_t* a, size_t n, limb_t b)
+	{
+		limb_t carry = 0;
+		for (size_t i = 0; i < n; i++)
+			r[i] = limbs::mulAddCarry(a[i], b, r[i], carry);
+
+		return carry;
+	}
+
+#ifdef KERNELS_X86
+	/// Checks processor features by CPUID.
+	/// AVX registers must be also enabled by operating system.
+	bool cpuSupports(kernels::Isa isa)
+	{
+#if defined(_MSC_VER)
+		int info[4];
+		__cpuid(info, 0);
+		if (info[0] < 7)
+			return false;
+
+		__cpuid(info, 1);
+		bool osxsave = (info[2] >> 27) & 1;
+		if (!osxsave)
+			return false;
+
+		unsigned long long xcr0 = _xgetbv(0);
+		__cpuidex(info, 7, 0);
+
+		bool avx2 = (xcr0 & 0x6) == 0x6 && ((info[1] >> 5) & 1) && ((info[1] >> 8) & 1);
+		bool avx512 = (xcr0 & 0xE6) == 0xE6 && ((info[1] >> 16) & 1);
+#else
+		bool avx2 = __builtin_cpu_supports("avx2") && __builtin_cpu_supports("bmi2");
+		bool avx512 = __builtin_cpu_supports("avx512f");
+#endif
+
+		switch (isa)
+		{
+		case kernels::Isa::avx2:
+			return avx2;
+		case kernels::Isa::avx512:
+			return avx2 && avx512;
+		default:
+			return true;
+		}
+	}
+#endif
+
+	/// Pointer to kernels used by limbs functions, the best one initially.
+	const kernels::Table*& current()
+	{
+		static const kernels::Table* table =
+			kernels::get(kernels::Isa::avx512) ? kernels::get(kernels::Isa::avx512) :
+			kernels::get(kernels::Isa::avx2) ? kernels::get(kernels::Isa::avx2) :
+			&kernels::scalarTable;
+
+		return table;
+	}
+}
+
+const kernels::Table kernels::scalarTable = { "scalar", cmpScalar, addNScalar, subNScalar, addMul1Scalar };
+
+const kernels::Table* kernels::get(Isa isa)
+{
+	switch (isa)
+	{
+#ifdef KERNELS_X86
+	case Isa::avx2:
+		return cpuSupports(isa) ? &avx2Table : nullptr;
+	case Isa::avx512:
+		return cpuSupports(isa) ? &avx512Table : nullptr;
+#endif
+	case Isa::scalar:
+		return &scalarTable;
+	default:
+		return nullptr;
+	}
+}
+
+const kernels::Table& kernels::active()
+{
+	return *current();
+}
+
+bool kernels::select(Isa isa)
+{
+	const Table* table = get(isa);
+	if (!table)
+		return false;
+
+	current() = table;
+	return true;
+}
@@ -0,0 +1,256 @@
+#include "../hdrs/Kernels.h"
+
+#ifdef KERNELS_X86
+
+#include <immintrin.h>
+
+#if defined(__GNUC__)
+// GCC and Clang compile functions for instruction set by attribute, so whole
+// program keeps working on processors without it.
+#define KERNEL_TARGET(isa) __attribute__((target(isa)))
+#else
+#define KERNEL_TARGET(isa)
+#endif
+
+namespace
+{
+	// Carry lookahead over lanes of vector.
+	// After adding vectors lane by lane, lane i generates carry (bit g_i)
+	// or passes incoming carry through, when its sum is all ones (bit p_i).
+	// Lanes never do both, so carries into all lanes are found
+	// by one integer addition over bit masks: c = ((g << 1 | cin) + p) ^ p.
+	// Bit after the last lane is carry out of vector.
+	// Subtraction is the same with borrows and all-zero differences.
+
+	/// Masks for adding carries to lanes of AVX2 vector, minus one in carrying lanes.
+	alignas(32) const int64_t laneMasks[16][4] =
+	{
+		{ 0, 0, 0, 0 }, { -1, 0, 0, 0 }, { 0, -1, 0, 0 }, { -1, -1, 0, 0 },
+		{ 0, 0, -1, 0 }, { -1, 0, -1, 0 }, { 0, -1, -1, 0 }, { -1, -1, -1, 0 },
+		{ 0, 0, 0, -1 }, { -1, 0, 0, -1 }, { 0, -1, 0, -1 }, { -1, -1, 0, -1 },
+		{ 0, 0, -1, -1 }, { -1, 0, -1, -1 }, { 0, -1, -1, -1 }, { -1, -1, -1, -1 }
+	};
+
+	KERNEL_TARGET("avx2")
+	inline unsigned laneMask(__m256i x)
+	{
+		return (unsigned)_mm256_movemask_pd(_mm256_castsi256_pd(x));
+	}
+
+	KERNEL_TARGET("avx2")
+	int cmpAvx2(const limb_t* a, const limb_t* b, size_t n)
+	{
+		for (; n >= 4; n -= 4)
+		{
+			__m256i x = _mm256_loadu_si256((const __m256i*)(a + n - 4));
+			__m256i y = _mm256_loadu_si256((const __m256i*)(b + n - 4));
+			unsigned diff = ~laneMask(_mm256_cmpeq_epi64(x, y)) & 0xF;
+
+			if (diff)
+			{
+				size_t i = n - 4 + (LIMB_BITS - 1 - limbs::countLeadingZeros(diff));
+				return a[i] < b[i] ? -1 : 1;
+			}
+		}
+
+		while (n-- > 0)
+		{
+			if (a[n] != b[n])
+				return a[n] < b[n] ? -1 : 1;
+		}
+
+		return 0;
+	}
+
+	KERNEL_TARGET("avx2")
+	limb_t addNAvx2(limb_t* r, const limb_t* a, const limb_t* b, size_t n)
+	{
+		const __m256i sign = _mm256_set1_epi64x(INT64_MIN);
+		const __m256i ones = _mm256_set1_epi64x(-1);
+
+		unsigned carry = 0;
+		size_t i = 0;
+
+		for (; i + 4 <= n; i += 4)
+		{
+			__m256i x = _mm256_loadu_si256((const __m256i*)(a + i));
+			__m256i y = _mm256_loadu_si256((const __m256i*)(b + i));
+			__m256i s = _mm256_add_epi64(x, y);
+
+			// unsigned s < x through signed comparison with flipped sign bits
+			unsigned g = laneMask(_mm256_cmpgt_epi64(_mm256_xor_si256(x, sign), _mm256_xor_si256(s, sign)));
+			unsigned p = laneMask(_mm256_cmpeq_epi64(s, ones));
+			unsigned c = (((g << 1) | carry) + p) ^ p;
+
+			s = _mm256_sub_epi64(s, _mm256_load_si256((const __m256i*)laneMasks[c & 0xF]));
+			_mm256_storeu_si256((__m256i*)(r + i), s);
+			carry = c >> 4;
+		}
+
+		limb_t rest = carry;
+		for (; i < n; i++)
+			r[i] = limbs::addCarry(a[i], b[i], rest);
+
+		return rest;
+	}
+
+	KERNEL_TARGET("avx2")
+	limb_t subNAvx2(limb_t* r, const limb_t* a, const limb_t* b, size_t n)
+	{
+		const __m256i sign = _mm256_set1_epi64x(INT64_MIN);
+		const __m256i zero = _mm256_setzero_si256();
+
+		unsigned borrow = 0;
+		size_t i = 0;
+
+		for (; i + 4 <= n; i += 4)
+		{
+			__m256i x = _mm256_loadu_si256((const __m256i*)(a + i));
+			__m256i y = _mm256_loadu_si256((const __m256i*)(b + i));
+			__m256i d = _mm256_sub_epi64(x, y);
+
+			unsigned g = laneMask(_mm256_cmpgt_epi64(_mm256_xor_si256(y, sign), _mm256_xor_si256(x, sign)));
+			unsigned p = laneMask(_mm256_cmpeq_epi64(d, zero));
+			unsigned c = (((g << 1) | borrow) + p) ^ p;
+
+			d = _mm256_add_epi64(d, _mm256_load_si256((const __m256i*)laneMasks[c & 0xF]));
+			_mm256_storeu_si256((__m256i*)(r + i), d);
+			borrow = c >> 4;
+		}
+
+		limb_t rest = borrow;
+		for (; i < n; i++)
+			r[i] = limbs::subBorrow(a[i], b[i], rest);
+
+		return rest;
+	}
+
+	// There is no 64x64 bit vector multiplication before AVX-512 IFMA,
+	// and IFMA needs 52-bit limbs. So multiplication uses scalar MULX,
+	// unrolled with two independent carry chains.
+	KERNEL_TARGET("bmi2")
+	limb_t addMul1Bmi2(limb_t* r, const limb_t* a, size_t n, limb_t b)
+	{
+		unsigned long long carry = 0;
+		size_t i = 0;
+
+		for (; i + 4 <= n; i += 4)
+		{
+			unsigned long long h0, h1, h2, h3;
+			unsigned long long l0 = _mulx_u64(a[i], b, &h0);
+			unsigned long long l1 = _mulx_u64(a[i + 1], b, &h1);
+			unsigned long long l2 = _mulx_u64(a[i + 2], b, &h2);
+			unsigned long long l3 = _mulx_u64(a[i + 3], b, &h3);
+
+			unsigned long long r0, r1, r2, r3;
+			unsigned char c1 = _addcarry_u64(0, r[i], l0, &r0);
+			c1 = _addcarry_u64(c1, r[i + 1], l1, &r1);
+			c1 = _addcarry_u64(c1, r[i + 2], l2, &r2);
+			c1 = _addcarry_u64(c1, r[i + 3], l3, &r3);
+
+			unsigned char c2 = _addcarry_u64(0, r0, carry, &r0);
+			c2 = _addcarry_u64(c2, r1, h0, &r1);
+			c2 = _addcarry_u64(c2, r2, h1, &r2);
+			c2 = _addcarry_u64(c2, r3, h2, &r3);
+
+			r[i] = r0;
+			r[i + 1] = r1;
+			r[i + 2] = r2;
+			r[i + 3] = r3;
+
+			// high limb of product is at most 2^64 - 2, so it holds both carries
+			carry = h3 + c1 + c2;
+		}
+
+		limb_t rest = carry;
+		for (; i < n; i++)
+			r[i] = limbs::mulAddCarry(a[i], b, r[i], rest);
+
+		return rest;
+	}
+
+	KERNEL_TARGET("avx512f")
+	int cmpAvx512(const limb_t* a, const limb_t* b, size_t n)
+	{
+		for (; n >= 8; n -= 8)
+		{
+			__m512i x = _mm512_loadu_si512((const void*)(a + n - 8));
+			__m512i y = _mm512_loadu_si512((const void*)(b + n - 8));
+			unsigned diff = _mm512_cmpneq_epu64_mask(x, y);
+
+			if (diff)
+			{
+				size_t i = n - 8 + (LIMB_BITS - 1 - limbs::countLeadingZeros(diff));
+				return a[i] < b[i] ? -1 : 1;
+			}
+		}
+
+		return cmpAvx2(a, b, n);
+	}
+
+	KERNEL_TARGET("avx512f")
+	limb_t addNAvx512(limb_t* r, const limb_t* a, const limb_t* b, size_t n)
+	{
+		const __m512i ones = _mm512_set1_epi64(-1);
+
+		unsigned carry = 0;
+		size_t i = 0;
+
+		for (; i + 8 <= n; i += 8)
+		{
+			__m512i x = _mm512_loadu_si512((const void*)(a + i));
+			__m512i y = _mm512_loadu_si512((const void*)(b + i));
+			__m512i s = _mm512_add_epi64(x, y);
+
+			unsigned g = _mm512_cmplt_epu64_mask(s, x);
+			unsigned p = _mm512_cmpeq_epu64_mask(s, ones);
+			unsigned c = (((g << 1) | carry) + p) ^ p;
+
+			s = _mm512_mask_sub_epi64(s, (__mmask8)c, s, ones);
+			_mm512_storeu_si512((void*)(r + i), s);
+			carry = c >> 8;
+		}
+
+		limb_t rest = carry;
+		for (; i < n; i++)
+			r[i] = limbs::addCarry(a[i], b[i], rest);
+
+		return rest;
+	}
+
+	KERNEL_TARGET("avx512f")
+	limb_t subNAvx512(limb_t* r, const limb_t* a, const limb_t* b, size_t n)
+	{
+		const __m512i ones = _mm512_set1_epi64(-1);
+
+		unsigned borrow = 0;
+		size_t i = 0;
+
+		for (; i + 8 <= n; i += 8)
+		{
+			__m512i x = _mm512_loadu_si512((const void*)(a + i));
+			__m512i y = _mm512_loadu_si512((const void*)(b + i));
+			__m512i d = _mm512_sub_epi64(x, y);
+
+			unsigned g = _mm512_cmplt_epu64_mask(x, y);
+			unsigned p = _mm512_cmpeq_epu64_mask(d, _mm512_setzero_si512());
+			unsigned c = (((g << 1) | borrow) + p) ^ p;
+
+			d = _mm512_mask_add_epi64(d, (__mmask8)c, d, ones);
+			_mm512_storeu_si512((void*)(r + i), d);
+			borrow = c >> 8;
+		}
+
+		limb_t rest = borrow;
+		for (; i < n; i++)
+			r[i] = limbs::subBorrow(a[i], b[i], rest);
+
+		return rest;
+	}
+}
+
+const kernels::Table kernels::avx2Table = { "avx2", cmpAvx2, addNAvx2, subNAvx2, addMul1Bmi2 };
+
+const kernels::Table kernels::avx512Table = { "avx512", cmpAvx512, addNAvx512, subNAvx512, addMul1Bmi2 };
+
+#endif
@@ -0,0 +1,121 @@
+#include "../hdrs/Limbs.h"
+#include "../hdrs/Kernels.h"
+
+int limbs::cmp(const limb_t* a, const limb_t* b, size_t n)
+{
+	return kernels::active().cmp(a, b, n);
+}
+
+limb_t limbs::addN(limb_t* r, const limb_t* a, const limb_t* b, size_t n)
+{
+	return kernels::active().addN(r, a, b, n);
+}
+
+limb_t limbs::add(limb_t* r, const limb_t* a, size_t an, const limb_t* b, size_t bn)
+{
+	limb_t carry = addN(r, a, b, bn);
+
+	for (size_t i = bn; i < an; i++)
+		r[i] = addCarry(a[i], 0, carry);
+
+	return carry;
+}
+
+limb_t limbs::subN(limb_t* r, const limb_t* a, const limb_t* b, size_t n)
+{
+	return kernels::active().subN(r, a, b, n);
+}
+
+limb_t limbs::sub(limb_t* r, const limb_t* a, size_t an, const limb_t* b, size_t bn)
+{
+	limb_t borrow = subN(r, a, b, bn);
+
+	for (size_t i = bn; i < an; i++)
+		r[i] = subBorrow(a[i], 0, borrow);
+
+	return borrow;
+}
+
+limb_t limbs::mul1(limb_t* r, const limb_t* a, size_t n, limb_t b)
+{
+	limb_t carry = 0;
+	for (size_t i = 0; i < n; i++)
+		r[i] = mulAddCarry(a[i], b, 0, carry);
+
+	return carry;
+}
+
+limb_t limbs::addMul1(limb_t* r, const limb_t* a, size_t n, limb_t b)
+{
+	return kernels::active().addMul1(r, a, n, b);
+}
+
+limb_t limbs::subMul1(limb_t* r, const limb_t* a, size_t n, limb_t b)
+{
+	limb_t carry = 0;
+	for (size_t i = 0; i < n; i++)
+	{
+		limb_t hi, overflow = 0, borrow = 0;
+		limb_t lo = addCarry(mulWide(a[i], b, hi), carry, overflow);
+
+		r[i] = subBorrow(r[i], lo, borrow);
+		carry = hi + overflow + borrow;
+	}
+
+	return carry;
+}
+
+void limbs::andN(limb_t* r, const limb_t* a, const limb_t* b, size_t n)
+{
+	for (size_t i = 0; i < n; i++)
+		r[i] = a[i] & b[i];
+}
+
+void limbs::andNotN(limb_t* r, const limb_t* a, const limb_t* b, size_t n)
+{
+	for (size_t i = 0; i < n; i++)
+		r[i] = a[i] & ~b[i];
+}
+
+void limbs::iorN(limb_t* r, const limb_t* a, const limb_t* b, size_t n)
+{
+	for (size_t i = 0; i < n; i++)
+		r[i] = a[i] | b[i];
+}
+
+void limbs::xorN(limb_t* r, const limb_t* a, const limb_t* b, size_t n)
+{
+	for (size_t i = 0; i < n; i++)
+		r[i] = a[i] ^ b[i];
+}
+
+limb_t limbs::shiftLeft(limb_t* r, const limb_t* a, size_t n, unsigned s)
+{
+	limb_t out = a[n - 1] >> (LIMB_BITS - s);
+
+	for (size_t i = n - 1; i > 0; i--)
+		r[i] = (a[i] << s) | (a[i - 1] >> (LIMB_BITS - s));
+	r[0] = a[0] << s;
+
+	return out;
+}
+
+limb_t limbs::shiftRight(limb_t* r, const limb_t* a, size_t n, unsigned s)
+{
+	limb_t out = a[0] << (LIMB_BITS - s);
+
+	for (size_t i = 0; i + 1 < n; i++)
+		r[i] = (a[i] >> s) | (a[i + 1] << (LIMB_BITS - s));
+	r[n - 1] = a[n - 1] >> s;
+
+	return out;
+}
+
+limb_t limbs::divRem1(limb_t* r, const limb_t* a, size_t n, limb_t d)
+{
+	limb_t rem = 0;
+	while (n-- > 0)
+		r[n] = divWide(rem, a[n], d, rem);
+
+	return rem;
+}
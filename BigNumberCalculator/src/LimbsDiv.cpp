@@ -0,0 +1,444 @@
+#include "../hdrs/Limbs.h"
+
+#include <vector>
+#include <algorithm>
+
+size_t limbs::bzThreshold = 64;
+size_t limbs::newtonThreshold = 32768;
+size_t limbs::barrettThreshold = 64;
+
+namespace
+{
+	/// Unsigned number without leading zero limbs, empty array is zero.
+	typedef std::vector<limb_t> Number;
+
+	/// Removes leading zero limbs.
+	void trim(Number& x)
+	{
+		while (!x.empty() && x.back() == 0)
+			x.pop_back();
+	}
+
+	/// Takes limbs [from, from + len) of number.
+	Number slice(const Number& a, size_t from, size_t len)
+	{
+		if (from >= a.size())
+			return Number();
+
+		Number res(a.begin() + from, a.begin() + from + std::min(len, a.size() - from));
+		trim(res);
+		return res;
+	}
+
+	/// Compares two numbers.
+	int cmpNum(const Number& a, const Number& b)
+	{
+		if (a.size() != b.size())
+			return a.size() < b.size() ? -1 : 1;
+
+		return limbs::cmp(a.data(), b.data(), a.size());
+	}
+
+	/// Computes a + b.
+	Number addNum(const Number& a, const Number& b)
+	{
+		const Number& x = a.size() >= b.size() ? a : b;
+		const Number& y = a.size() >= b.size() ? b : a;
+
+		Number res(x.size() + 1);
+		res.back() = limbs::add(res.data(), x.data(), x.size(), y.data(), y.size());
+		trim(res);
+		return res;
+	}
+
+	/// Computes a - b, where a >= b.
+	Number subNum(const Number& a, const Number& b)
+	{
+		Number res(a.size());
+		limbs::sub(res.data(), a.data(), a.size(), b.data(), b.size());
+		trim(res);
+		return res;
+	}
+
+	/// Computes a * b.
+	Number mulNum(const Number& a, const Number& b)
+	{
+		if (a.empty() || b.empty())
+			return Number();
+
+		const Number& x = a.size() >= b.size() ? a : b;
+		const Number& y = a.size() >= b.size() ? b : a;
+
+		Number res(x.size() + y.size());
+		limbs::mul(res.data(), x.data(), x.size(), y.data(), y.size());
+		trim(res);
+		return res;
+	}
+
+	/// Computes a * B^k.
+	Number shifted(const Number& a, size_t k)
+	{
+		if (a.empty())
+			return a;
+
+		Number res(k, 0);
+		res.insert(res.end(), a.begin(), a.end());
+		return res;
+	}
+
+	/// Divides numbers of any length with schoolbook algorithm.
+	void divNumSchoolbook(const Number& a, const Number& b, Number& q, Number& r)
+	{
+		if (cmpNum(a, b) < 0)
+		{
+			q.clear();
+			r = a;
+			return;
+		}
+
+		q.assign(a.size() - b.size() + 1, 0);
+		r.assign(b.size(), 0);
+
+		if (b.size() == 1)
+			r[0] = limbs::divRem1(q.data(), a.data(), a.size(), b[0]);
+		else
+			limbs::divRemSchoolbook(q.data(), r.data(), a.data(), a.size(), b.data(), b.size());
+
+		trim(q);
+		trim(r);
+	}
+
+	void div2n1n(const Number& a, const Number& b, size_t n, Number& q, Number& r);
+
+	/// Burnikel-Ziegler division of 3h limbs by 2h limbs.
+	/// @param a dividend, which is less than b * B^h.
+	/// @param b normalized divisor with 2h limbs.
+	/// @param h half of divisor length.
+	/// @param[out] q quotient.
+	/// @param[out] r reminder.
+	void div3n2n(const Number& a, const Number& b, size_t h, Number& q, Number& r)
+	{
+		Number b1 = slice(b, h, h), b2 = slice(b, 0, h);
+		Number a1 = slice(a, 2 * h, h), a12 = slice(a, h, 2 * h);
+		Number r1;
+
+		if (cmpNum(a1, b1) < 0)
+			div2n1n(a12, b1, h, q, r1);
+		else
+		{
+			// a1 == b1 here, quotient is B^h - 1 and a12 - q * b1 = a2 + b1
+			q.assign(h, ~(limb_t)0);
+			r1 = addNum(slice(a, h, h), b1);
+		}
+
+		Number d = mulNum(q, b2);
+		Number x = addNum(shifted(r1, h), slice(a, 0, h));
+
+		// estimated quotient is at most 2 more than real one
+		while (cmpNum(x, d) < 0)
+		{
+			x = addNum(x, b);
+			q = subNum(q, Number(1, 1));
+		}
+
+		r = subNum(x, d);
+	}
+
+	/// Burnikel-Ziegler division of 2n limbs by n limbs.
+	/// @param a dividend, which is less than b * B^n.
+	/// @param b normalized divisor with n limbs.
+	/// @param n divisor length.
+	/// @param[out] q quotient.
+	/// @param[out] r reminder.
+	void div2n1n(const Number& a, const Number& b, size_t n, Number& q, Number& r)
+	{
+		if (n % 2 || n < limbs::bzThreshold)
+		{
+			divNumSchoolbook(a, b, q, r);
+			return;
+		}
+
+		size_t h = n / 2;
+		Number q1, r1, q2;
+
+		div3n2n(slice(a, h, 3 * h), b, h, q1, r1);
+		div3n2n(addNum(shifted(r1, h), slice(a, 0, h)), b, h, q2, r);
+
+		q = addNum(shifted(q1, h), q2);
+	}
+
+	/// Computes floor((B^2n - 1) / d) by Newton iteration.
+	/// Precision is doubled on each level of recursion.
+	/// @param d normalized divisor with n limbs.
+	/// @return reciprocal with n + 1 limbs.
+	Number reciprocal(const Number& d)
+	{
+		size_t n = d.size();
+
+		Number one2n(2 * n + 1, 0);
+		one2n.back() = 1;
+		Number target = subNum(one2n, Number(1, 1));
+
+		Number x;
+		if (n < 8)
+		{
+			Number r;
+			divNumSchoolbook(target, d, x, r);
+			return x;
+		}
+
+		// start from reciprocal of the high part, which is correct in about h limbs
+		size_t h = n / 2 + 2;
+		x = shifted(reciprocal(slice(d, n - h, h)), n - h);
+
+		// one Newton step: x = x + x * (B^2n - d * x) / B^2n
+		Number p = mulNum(d, x);
+		if (cmpNum(p, one2n) <= 0)
+			x = addNum(x, slice(mulNum(x, subNum(one2n, p)), 2 * n, SIZE_MAX));
+		else
+		{
+			Number corr = addNum(slice(mulNum(x, subNum(p, one2n)), 2 * n, SIZE_MAX), Number(1, 1));
+			x = cmpNum(x, corr) > 0 ? subNum(x, corr) : Number();
+		}
+
+		// exact correction, error is only a few units here
+		p = mulNum(d, x);
+		while (cmpNum(p, target) > 0)
+		{
+			x = subNum(x, Number(1, 1));
+			p = subNum(p, d);
+		}
+		while (cmpNum(subNum(target, p), d) >= 0)
+		{
+			x = addNum(x, Number(1, 1));
+			p = addNum(p, d);
+		}
+
+		return x;
+	}
+
+	/// Divides 2n limbs by n limbs with precomputed reciprocal (Barrett's method).
+	/// @param a dividend, which is less than d * B^n.
+	/// @param d normalized divisor with n limbs.
+	/// @param inv reciprocal of d.
+	/// @param[out] q quotient.
+	/// @param[out] r reminder.
+	void divByReciprocal(const Number& a, const Number& d, const Number& inv, Number& q, Number& r)
+	{
+		size_t n = d.size();
+
+		// estimation never exceeds real quotient and is less by at most 2
+		q = slice(mulNum(slice(a, n - 1, n + 1), inv), n + 1, SIZE_MAX);
+		r = subNum(a, mulNum(q, d));
+
+		while (cmpNum(r, d) >= 0)
+		{
+			r = subNum(r, d);
+			q = addNum(q, Number(1, 1));
+		}
+	}
+
+	/// Divides number by divisor, splitting dividend to blocks of n limbs.
+	/// @param a dividend.
+	/// @param b normalized divisor with n limbs.
+	/// @param[out] q quotient.
+	/// @param[out] r reminder.
+	/// @param divBlock division of 2n limbs by n limbs.
+	template<class DivBlock>
+	void divByBlocks(const Number& a, const Number& b, Number& q, Number& r, DivBlock divBlock)
+	{
+		size_t n = b.size();
+
+		// the highest block of dividend is less than divisor
+		size_t t = std::max<size_t>(2, a.size() / n + 1);
+
+		q.assign(t * n, 0);
+		Number z = slice(a, (t - 2) * n, 2 * n);
+
+		for (size_t i = t - 1; i-- > 0;)
+		{
+			Number qi;
+			divBlock(z, qi, r);
+			std::copy(qi.begin(), qi.end(), q.begin() + i * n);
+
+			if (i > 0)
+				z = addNum(shifted(r, n), slice(a, (i - 1) * n, n));
+		}
+
+		trim(q);
+	}
+
+	/// Shifts array to the left by s bits and k limbs, result is trimmed.
+	Number normalize(const limb_t* a, size_t n, unsigned s, size_t k)
+	{
+		Number res(k + n + 1, 0);
+		if (s)
+			res.back() = limbs::shiftLeft(res.data() + k, a, n, s);
+		else
+			std::copy(a, a + n, res.begin() + k);
+
+		trim(res);
+		return res;
+	}
+
+	/// Copies number to array of n limbs, shifting it to the right by s bits and k limbs.
+	void denormalize(limb_t* res, size_t n, Number a, unsigned s, size_t k)
+	{
+		a.resize(std::max(a.size(), k + n + 1), 0);
+		if (s)
+			limbs::shiftRight(a.data() + k, a.data() + k, n + 1, s);
+
+		std::copy(a.begin() + k, a.begin() + k + n, res);
+	}
+
+	/// Copies number to array of n limbs.
+	void copyTo(limb_t* res, size_t n, const Number& a)
+	{
+		std::fill(res, res + n, 0);
+		std::copy(a.begin(), a.begin() + std::min(n, a.size()), res);
+	}
+	/// Divides normalized numbers with Knuth's algorithm D.
+	/// Quotient digits are estimated by two high limbs of divisor,
+	/// dividend is updated in place.
+	/// @param[out] q quotient with un - vn limbs.
+	/// @param[in, out] u dividend with un limbs, which is less than v * B^(un - vn),
+	///  reminder is left in its low vn limbs.
+	/// @param v divisor with vn >= 2 limbs and the highest bit set.
+	void divSchoolbook(limb_t* q, limb_t* u, size_t un, const limb_t* v, size_t vn)
+	{
+		const limb_t vTop = v[vn - 1], vNext = v[vn - 2];
+
+		for (size_t j = un - vn; j-- > 0;)
+		{
+			limb_t* uj = u + j;
+			limb_t top = uj[vn];
+			limb_t qhat, rhat, rhatOverflow = 0;
+
+			if (top >= vTop)
+			{
+				// quotient digit doesn't fit into limb, start from the maximal one
+				qhat = ~(limb_t)0;
+				rhat = limbs::addCarry(uj[vn - 1], vTop, rhatOverflow);
+			}
+			else
+				qhat = limbs::divWide(top, uj[vn - 1], vTop, rhat);
+
+			// qhat is at most 2 more than real digit, fix it by the next limb of divisor
+			while (!rhatOverflow)
+			{
+				limb_t hi, lo = limbs::mulWide(qhat, vNext, hi);
+				if (hi < rhat || (hi == rhat && lo <= uj[vn - 2]))
+					break;
+
+				qhat--;
+				rhat = limbs::addCarry(rhat, vTop, rhatOverflow);
+			}
+
+			limb_t borrow = 0;
+			uj[vn] = limbs::subBorrow(top, limbs::subMul1(uj, v, vn, qhat), borrow);
+
+			if (borrow)
+			{
+				// rare case: qhat was still one more than real digit
+				qhat--;
+				uj[vn] += limbs::addN(uj, uj, v, vn);
+			}
+
+			q[j] = qhat;
+		}
+	}
+}
+
+void limbs::divRemSchoolbook(limb_t* q, limb_t* r, const limb_t* a, size_t an, const limb_t* d, size_t dn)
+{
+	// normalization: the highest bit of divisor must be set
+	unsigned s = countLeadingZeros(d[dn - 1]);
+
+	std::vector<limb_t> u(an + 1), v(dn);
+	if (s)
+	{
+		u[an] = shiftLeft(u.data(), a, an, s);
+		shiftLeft(v.data(), d, dn, s);
+	}
+	else
+	{
+		std::copy(a, a + an, u.begin());
+		std::copy(d, d + dn, v.begin());
+	}
+
+	divSchoolbook(q, u.data(), an + 1, v.data(), dn);
+
+	if (s)
+		shiftRight(r, u.data(), dn, s);
+	else
+		std::copy(u.begin(), u.begin() + dn, r);
+}
+
+void limbs::divRemBZ(limb_t* q, limb_t* r, const limb_t* a, size_t an, const limb_t* d, size_t dn)
+{
+	// Block length n = j * 2^k, so that recursion halves it k times
+	// and stops at j < bzThreshold limbs.
+	size_t m = 1;
+	while (m * bzThreshold <= dn)
+		m <<= 1;
+	size_t n = (dn + m - 1) / m * m;
+
+	// divisor is shifted to exactly n limbs with the highest bit set
+	unsigned s = countLeadingZeros(d[dn - 1]);
+	size_t k = n - dn;
+
+	Number b = normalize(d, dn, s, k);
+	Number qn, rn;
+	divByBlocks(normalize(a, an, s, k), b, qn, rn,
+		[&](const Number& z, Number& qi, Number& ri) { div2n1n(z, b, n, qi, ri); });
+
+	copyTo(q, an - dn + 1, qn);
+	denormalize(r, dn, rn, s, k);
+}
+
+void limbs::divRemNewton(limb_t* q, limb_t* r, const limb_t* a, size_t an, const limb_t* d, size_t dn)
+{
+	unsigned s = countLeadingZeros(d[dn - 1]);
+
+	Number b = normalize(d, dn, s, 0);
+	Number inv = reciprocal(b);
+	Number qn, rn;
+	divByBlocks(normalize(a, an, s, 0), b, qn, rn,
+		[&](const Number& z, Number& qi, Number& ri) { divByReciprocal(z, b, inv, qi, ri); });
+
+	copyTo(q, an - dn + 1, qn);
+	denormalize(r, dn, rn, s, 0);
+}
+
+void limbs::barrettReciprocal(limb_t* inv, const limb_t* d, size_t n)
+{
+	Number x = reciprocal(normalize(d, n, countLeadingZeros(d[n - 1]), 0));
+	copyTo(inv, n + 1, x);
+}
+
+void limbs::modBarrett(limb_t* r, const limb_t* a, size_t an, const limb_t* d, size_t n, const limb_t* inv)
+{
+	unsigned s = countLeadingZeros(d[n - 1]);
+
+	Number b = normalize(d, n, s, 0);
+	Number x(inv, inv + n + 1);
+	trim(x);
+
+	Number qn, rn;
+	divByBlocks(normalize(a, an, s, 0), b, qn, rn,
+		[&](const Number& z, Number& qi, Number& ri) { divByReciprocal(z, b, x, qi, ri); });
+
+	denormalize(r, n, rn, s, 0);
+}
+
+void limbs::divRem(limb_t* q, limb_t* r, const limb_t* a, size_t an, const limb_t* d, size_t dn)
+{
+	size_t qn = an - dn + 1;
+
+	if (dn < bzThreshold || qn < bzThreshold)
+		divRemSchoolbook(q, r, a, an, d, dn);
+	else if (dn >= newtonThreshold && qn >= newtonThreshold)
+		divRemNewton(q, r, a, an, d, dn);
+	else
+		divRemBZ(q, r, a, an, d, dn);
+}
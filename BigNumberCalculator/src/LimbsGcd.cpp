@@ -0,0 +1,177 @@
+#include "../hdrs/Limbs.h"
+
+#include <algorithm>
+
+size_t limbs::hgcdThreshold = 150;
+
+namespace
+{
+	/// Unsigned number of two limbs.
+	struct Wide
+	{
+		limb_t hi, lo;
+	};
+
+	bool less(const Wide& a, const Wide& b)
+	{
+		return a.hi < b.hi || (a.hi == b.hi && a.lo < b.lo);
+	}
+
+	bool isZero(const Wide& a)
+	{
+		return a.hi == 0 && a.lo == 0;
+	}
+
+	Wide sub(const Wide& a, const Wide& b)
+	{
+		limb_t borrow = 0;
+		Wide r;
+		r.lo = limbs::subBorrow(a.lo, b.lo, borrow);
+		r.hi = limbs::subBorrow(a.hi, b.hi, borrow);
+		return r;
+	}
+
+	/// Sum of two limbs, it always fits.
+	Wide sum(limb_t a, limb_t b)
+	{
+		limb_t carry = 0;
+		Wide r;
+		r.lo = limbs::addCarry(a, b, carry);
+		r.hi = carry;
+		return r;
+	}
+
+	/// Shifts to the left by s < LIMB_BITS bits, high bits are lost.
+	Wide shl(const Wide& a, unsigned s)
+	{
+		if (s == 0)
+			return a;
+
+		return { (a.hi << s) | (a.lo >> (LIMB_BITS - s)), a.lo << s };
+	}
+
+	unsigned bitLength(const Wide& a)
+	{
+		if (a.hi)
+			return 2 * LIMB_BITS - limbs::countLeadingZeros(a.hi);
+		if (a.lo)
+			return LIMB_BITS - limbs::countLeadingZeros(a.lo);
+		return 0;
+	}
+
+	/// Divides x by nonzero y, x is replaced by reminder.
+	/// Quotients of Euclid's algorithm are small in most cases,
+	/// so binary division by bit length difference is enough.
+	/// @return false if quotient doesn't fit into one limb.
+	bool divWideSmall(Wide& x, const Wide& y, limb_t& q)
+	{
+		q = 0;
+		if (less(x, y))
+			return true;
+
+		unsigned d = bitLength(x) - bitLength(y);
+		if (d >= LIMB_BITS)
+			return false;
+
+		for (unsigned i = d + 1; i-- > 0;)
+		{
+			Wide ys = shl(y, i);
+			if (!less(x, ys))
+			{
+				x = sub(x, ys);
+				q |= (limb_t)1 << i;
+			}
+		}
+
+		return true;
+	}
+
+	/// Computes c0 + q * c1, if it fits into one limb.
+	bool nextCofactor(limb_t c0, limb_t q, limb_t c1, limb_t& res)
+	{
+		limb_t hi, carry = 0;
+		limb_t lo = limbs::mulWide(q, c1, hi);
+		res = limbs::addCarry(lo, c0, carry);
+		return hi == 0 && carry == 0;
+	}
+
+	/// Limb i of array a, shifted to the left by c bits, limbs out of array are zeros.
+	limb_t shiftedLimb(const limb_t* a, size_t n, size_t i, unsigned c)
+	{
+		limb_t cur = i < n ? a[i] : 0;
+		limb_t prev = i >= 1 && i - 1 < n ? a[i - 1] : 0;
+
+		return c ? (cur << c) | (prev >> (LIMB_BITS - c)) : cur;
+	}
+}
+
+bool limbs::lehmerMatrix(const limb_t* a, const limb_t* b, size_t n, LehmerMatrix& m)
+{
+	// high 2 * LIMB_BITS bits of a with the same bits of b
+	unsigned c = countLeadingZeros(a[n - 1]);
+	Wide x0 = { shiftedLimb(a, n, n - 1, c), n >= 2 ? shiftedLimb(a, n, n - 2, c) : 0 };
+	Wide x1 = { shiftedLimb(b, n, n - 1, c), n >= 2 ? shiftedLimb(b, n, n - 2, c) : 0 };
+
+	// x0 = s0 * a - t0 * b and x1 = t1 * b - s1 * a after even count of steps,
+	// signs are opposite after odd count
+	limb_t s0 = 1, t0 = 0, s1 = 0, t1 = 1;
+	bool odd = false, any = false;
+
+	while (!isZero(x1))
+	{
+		Wide x2 = x0;
+		limb_t q, s2, t2;
+		if (!divWideSmall(x2, x1, q) || !nextCofactor(s0, q, s1, s2) || !nextCofactor(t0, q, t1, t2))
+			break;
+
+		// Jebelean's condition: truncated low bits can't change
+		// quotient, if remainder and its distance to previous one
+		// are not less than cofactors, which multiply these bits
+		if (less(x2, { 0, std::max(s2, t2) }))
+			break;
+
+		Wide ds = sum(s2, s1), dt = sum(t2, t1);
+		if (less(sub(x1, x2), less(ds, dt) ? dt : ds))
+			break;
+
+		x0 = x1;
+		x1 = x2;
+		s0 = s1;
+		s1 = s2;
+		t0 = t1;
+		t1 = t2;
+		odd = !odd;
+		any = true;
+	}
+
+	m = { s0, t0, s1, t1, odd };
+	return any;
+}
+
+void limbs::lehmerApply(limb_t* a, limb_t* b, size_t n, const LehmerMatrix& m, limb_t* tmp)
+{
+	const limb_t* x = m.odd ? b : a;
+	const limb_t* y = m.odd ? a : b;
+
+	// both results are not negative and not greater than a
+	mul1(tmp, x, n, m.odd ? m.t0 : m.s0);
+	subMul1(tmp, y, n, m.odd ? m.s0 : m.t0);
+
+	mul1(tmp + n, y, n, m.odd ? m.s1 : m.t1);
+	subMul1(tmp + n, x, n, m.odd ? m.t1 : m.s1);
+
+	std::copy(tmp, tmp + n, a);
+	std::copy(tmp + n, tmp + 2 * n, b);
+}
+
+limb_t limbs::gcd1(limb_t a, limb_t b)
+{
+	while (b)
+	{
+		limb_t r = a % b;
+		a = b;
+		b = r;
+	}
+
+	return a;
+}
@@ -0,0 +1,388 @@
+#include "../hdrs/Limbs.h"
+
+#include <vector>
+#include <algorithm>
+
+namespace
+{
+	/// Reduces a with an limbs modulo m with n limbs, where an >= n.
+	void modNum(limb_t* r, const limb_t* a, size_t an, const limb_t* m, size_t n)
+	{
+		if (n == 1)
+		{
+			std::vector<limb_t> q(an);
+			r[0] = limbs::divRem1(q.data(), a, an, m[0]);
+			return;
+		}
+
+		std::vector<limb_t> q(an - n + 1);
+		limbs::divRem(q.data(), r, a, an, m, n);
+	}
+
+	///
+	/// Multiplication modulo odd m in Montgomery form x * R mod m, R = 2^(n * LIMB_BITS).
+	/// Reduction needs n multiplications by one limb instead of a division.
+	///
+	class MontgomeryRing
+	{
+		const limb_t* m;
+		size_t n;
+
+		/// -m^-1 modulo 2^LIMB_BITS.
+		limb_t minv;
+
+		/// Product with 2n limbs.
+		std::vector<limb_t> t;
+
+	public:
+		MontgomeryRing(const limb_t* m, size_t n)
+			:
+			m(m), n(n), minv(limbs::montInverse(m[0])), t(2 * n)
+		{
+		}
+
+		/// Computes r = a * R mod m.
+		void toForm(limb_t* r, const limb_t* a)
+		{
+			std::fill(t.begin(), t.begin() + n, 0);
+			std::copy(a, a + n, t.begin() + n);
+			modNum(r, t.data(), 2 * n, m, n);
+		}
+
+		/// Computes r = a * R^-1 mod m.
+		void fromForm(limb_t* r, const limb_t* a)
+		{
+			std::copy(a, a + n, t.begin());
+			std::fill(t.begin() + n, t.end(), 0);
+			limbs::redc(r, t.data(), m, n, minv);
+		}
+
+		void mul(limb_t* r, const limb_t* a, const limb_t* b)
+		{
+			limbs::mul(t.data(), a, n, b, n);
+			limbs::redc(r, t.data(), m, n, minv);
+		}
+
+		void sqr(limb_t* r, const limb_t* a)
+		{
+			limbs::sqr(t.data(), a, n);
+			limbs::redc(r, t.data(), m, n, minv);
+		}
+	};
+
+	///
+	/// Multiplication modulo any m with reduction by division.
+	///
+	class DivisionRing
+	{
+		const limb_t* m;
+		size_t n;
+
+		/// Product with 2n limbs.
+		std::vector<limb_t> t;
+
+	public:
+		DivisionRing(const limb_t* m, size_t n)
+			:
+			m(m), n(n), t(2 * n)
+		{
+		}
+
+		void toForm(limb_t* r, const limb_t* a) { std::copy(a, a + n, r); }
+
+		void fromForm(limb_t* r, const limb_t* a) { std::copy(a, a + n, r); }
+
+		void mul(limb_t* r, const limb_t* a, const limb_t* b)
+		{
+			limbs::mul(t.data(), a, n, b, n);
+			modNum(r, t.data(), 2 * n, m, n);
+		}
+
+		void sqr(limb_t* r, const limb_t* a)
+		{
+			limbs::sqr(t.data(), a, n);
+			modNum(r, t.data(), 2 * n, m, n);
+		}
+	};
+
+	/// Computes r = a^e mod m with n limbs by left-to-right sliding window.
+	/// Ring keeps numbers in its own form between multiplications.
+	template<class Ring>
+	void slidingPower(Ring& ring, limb_t* r, const limb_t* a, const limb_t* e, size_t en, size_t n)
+	{
+		size_t bits = 0;
+		for (size_t i = en; i-- > 0;)
+		{
+			if (e[i])
+			{
+				bits = i * LIMB_BITS + LIMB_BITS - limbs::countLeadingZeros(e[i]);
+				break;
+			}
+		}
+
+		auto bit = [e](size_t i) { return (e[i / LIMB_BITS] >> (i % LIMB_BITS)) & 1; };
+
+		// window size grows with exponent, so precomputed odd powers
+		// a, a^3, ..., a^(2^k - 1) save more multiplications than they cost
+		size_t k = bits <= 7 ? 1 : bits <= 25 ? 2 : bits <= 81 ? 3 : bits <= 241 ? 4 : bits <= 673 ? 5 : 6;
+
+		std::vector<limb_t> odd(n << (k - 1));
+		ring.toForm(odd.data(), a);
+		if (k > 1)
+		{
+			std::vector<limb_t> sqr(n);
+			ring.sqr(sqr.data(), odd.data());
+			for (size_t i = 1; i < ((size_t)1 << (k - 1)); i++)
+				ring.mul(odd.data() + i * n, odd.data() + (i - 1) * n, sqr.data());
+		}
+
+		// exponent zero gives 1
+		std::vector<limb_t> res(n, 0), tmp(n);
+		res[0] = 1;
+		ring.toForm(tmp.data(), res.data());
+		std::swap(res, tmp);
+
+		bool first = true;
+		for (size_t i = bits; i-- > 0;)
+		{
+			if (!bit(i))
+			{
+				ring.sqr(tmp.data(), res.data());
+				std::swap(res, tmp);
+				continue;
+			}
+
+			// window [j, i] starts and ends with one bit
+			size_t j = i + 1 >= k ? i + 1 - k : 0;
+			while (!bit(j))
+				j++;
+
+			size_t window = 0;
+			for (size_t t = i + 1; t-- > j;)
+				window = window << 1 | bit(t);
+
+			if (first)
+				std::copy(odd.begin() + (window >> 1) * n, odd.begin() + (window >> 1) * n + n, res.begin());
+			else
+			{
+				for (size_t t = j; t <= i; t++)
+				{
+					ring.sqr(tmp.data(), res.data());
+					std::swap(res, tmp);
+				}
+				ring.mul(tmp.data(), res.data(), odd.data() + (window >> 1) * n);
+				std::swap(res, tmp);
+			}
+
+			first = false;
+			i = j;
+		}
+
+		ring.fromForm(r, res.data());
+	}
+
+	bool isZero(const limb_t* a, size_t n)
+	{
+		return std::all_of(a, a + n, [](limb_t x) { return x == 0; });
+	}
+
+	/// Bit i of array a.
+	bool bit(const limb_t* a, size_t i)
+	{
+		return (a[i / LIMB_BITS] >> (i % LIMB_BITS)) & 1;
+	}
+
+	/// Index of the lowest set bit of nonzero a.
+	size_t lowBit(const limb_t* a)
+	{
+		size_t i = 0;
+		while (!bit(a, i))
+			i++;
+		return i;
+	}
+
+	/// Index of the highest set bit of nonzero a with n limbs.
+	size_t highBit(const limb_t* a, size_t n)
+	{
+		while (!a[n - 1])
+			n--;
+		return n * LIMB_BITS - 1 - limbs::countLeadingZeros(a[n - 1]);
+	}
+
+	/// Computes r = a + b mod m, all arrays have n limbs.
+	void addMod(limb_t* r, const limb_t* a, const limb_t* b, const limb_t* m, size_t n)
+	{
+		limb_t carry = limbs::addN(r, a, b, n);
+		if (carry || limbs::cmp(r, m, n) >= 0)
+			limbs::subN(r, r, m, n);
+	}
+
+	/// Computes r = a - b mod m, all arrays have n limbs.
+	void subMod(limb_t* r, const limb_t* a, const limb_t* b, const limb_t* m, size_t n)
+	{
+		if (limbs::subN(r, a, b, n))
+			limbs::addN(r, r, m, n);
+	}
+
+	/// Computes r = a * q mod m for small q, Montgomery form is kept.
+	/// @param t memory for n + 1 limbs.
+	void mulSmallMod(limb_t* r, const limb_t* a, int q, const limb_t* m, size_t n, limb_t* t)
+	{
+		t[n] = limbs::mul1(t, a, n, (limb_t)(q < 0 ? -q : q));
+		modNum(r, t, n + 1, m, n);
+
+		if (q < 0 && !isZero(r, n))
+			limbs::subN(r, m, r, n);
+	}
+
+	/// Strong probable prime test to base 2 for odd m > 2.
+	/// Powers of 2 need only squarings and doublings.
+	bool strongBase2(MontgomeryRing& ring, const limb_t* m, size_t n, const limb_t* one, const limb_t* minusOne)
+	{
+		// m - 1 = d * 2^s with odd d
+		std::vector<limb_t> e(m, m + n);
+		e[0]--;
+		size_t s = lowBit(e.data());
+
+		std::vector<limb_t> x(one, one + n);
+		for (size_t i = highBit(e.data(), n) + 1; i-- > s;)
+		{
+			ring.sqr(x.data(), x.data());
+			if (bit(e.data(), i))
+				addMod(x.data(), x.data(), x.data(), m, n);
+		}
+
+		if (std::equal(x.begin(), x.end(), one) || std::equal(x.begin(), x.end(), minusOne))
+			return true;
+
+		for (size_t i = 1; i < s; i++)
+		{
+			ring.sqr(x.data(), x.data());
+			if (std::equal(x.begin(), x.end(), minusOne))
+				return true;
+			if (std::equal(x.begin(), x.end(), one))
+				return false;
+		}
+
+		return false;
+	}
+
+	/// Strong Lucas probable prime test for odd m with parameters P = 1, Q = (1 - d) / 4.
+	/// Only V(k) is computed by Lucas chain, U(k) = 0 is checked as D * U(k) = 2 * V(k + 1) - P * V(k).
+	bool strongLucas(MontgomeryRing& ring, const limb_t* m, size_t n, int d, const limb_t* one)
+	{
+		int q = (1 - d) / 4;
+
+		// m + 1 = k * 2^s with odd k
+		std::vector<limb_t> e(n + 1, 0);
+		limb_t unit = 1;
+		std::copy(m, m + n, e.begin());
+		limbs::add(e.data(), e.data(), n + 1, &unit, 1);
+		size_t s = lowBit(e.data());
+
+		// v = V(k), v1 = V(k + 1), qk = Q^k, starting from k = 0
+		std::vector<limb_t> v(n), v1(one, one + n), qk(one, one + n), qk1(n), t(n), small(n + 1);
+		addMod(v.data(), one, one, m, n);
+
+		for (size_t i = highBit(e.data(), n + 1) + 1; i-- > s;)
+		{
+			// V(2k + 1) = V(k) * V(k + 1) - P * Q^k
+			ring.mul(t.data(), v.data(), v1.data());
+			subMod(t.data(), t.data(), qk.data(), m, n);
+
+			if (bit(e.data(), i))
+			{
+				// V(2k + 2) = V(k + 1)^2 - 2 * Q^(k + 1)
+				mulSmallMod(qk1.data(), qk.data(), q, m, n, small.data());
+				ring.sqr(v1.data(), v1.data());
+				subMod(v1.data(), v1.data(), qk1.data(), m, n);
+				subMod(v1.data(), v1.data(), qk1.data(), m, n);
+				std::swap(v, t);
+
+				// Q^(2k + 1) = (Q^k)^2 * Q
+				ring.sqr(qk.data(), qk.data());
+				mulSmallMod(qk.data(), qk.data(), q, m, n, small.data());
+				continue;
+			}
+
+			// V(2k) = V(k)^2 - 2 * Q^k
+			ring.sqr(v.data(), v.data());
+			subMod(v.data(), v.data(), qk.data(), m, n);
+			subMod(v.data(), v.data(), qk.data(), m, n);
+			std::swap(v1, t);
+			ring.sqr(qk.data(), qk.data());
+		}
+
+		// U(k) = 0 or V(k * 2^r) = 0 for some r < s
+		addMod(t.data(), v1.data(), v1.data(), m, n);
+		if (std::equal(t.begin(), t.end(), v.begin()) || isZero(v.data(), n))
+			return true;
+
+		for (size_t r = 1; r < s; r++)
+		{
+			ring.sqr(v.data(), v.data());
+			subMod(v.data(), v.data(), qk.data(), m, n);
+			subMod(v.data(), v.data(), qk.data(), m, n);
+			if (isZero(v.data(), n))
+				return true;
+
+			ring.sqr(qk.data(), qk.data());
+		}
+
+		return false;
+	}
+}
+
+limb_t limbs::montInverse(limb_t m)
+{
+	// m * m = 1 modulo 8 for odd m, and each Newton step doubles count of correct bits
+	limb_t x = m;
+	for (unsigned bits = 3; bits < LIMB_BITS; bits *= 2)
+		x *= 2 - m * x;
+
+	return 0 - x;
+}
+
+void limbs::redc(limb_t* r, limb_t* t, const limb_t* m, size_t n, limb_t minv)
+{
+	// each step zeroes the low limb of t, so the limb keeps carry,
+	// which is added to the high half after the loop
+	for (size_t i = 0; i < n; i++)
+		t[i] = addMul1(t + i, m, n, t[i] * minv);
+
+	limb_t carry = addN(r, t + n, t, n);
+	if (carry || cmp(r, m, n) >= 0)
+		subN(r, r, m, n);
+}
+
+void limbs::powMod(limb_t* r, const limb_t* a, const limb_t* e, size_t en, const limb_t* m, size_t n)
+{
+	if (n == 1 && m[0] == 1)
+	{
+		r[0] = 0;
+		return;
+	}
+
+	if (m[0] & 1)
+	{
+		MontgomeryRing ring(m, n);
+		slidingPower(ring, r, a, e, en, n);
+	}
+	else
+	{
+		DivisionRing ring(m, n);
+		slidingPower(ring, r, a, e, en, n);
+	}
+}
+
+bool limbs::isProbablePrime(const limb_t* m, size_t n, int d)
+{
+	MontgomeryRing ring(m, n);
+
+	std::vector<limb_t> one(n, 0), minusOne(n);
+	one[0] = 1;
+	ring.toForm(one.data(), one.data());
+	subN(minusOne.data(), m, one.data(), n);
+
+	return strongBase2(ring, m, n, one.data(), minusOne.data()) && strongLucas(ring, m, n, d, one.data());
+}
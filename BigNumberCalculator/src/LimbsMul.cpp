@@ -0,0 +1,398 @@
+#include "../hdrs/Limbs.h"
+#include "../hdrs/ThreadPool.h"
+
+#include <vector>
+#include <algorithm>
+
+size_t limbs::karatsubaThreshold = 32;
+size_t limbs::toom3Threshold = 256;
+size_t limbs::parallelThreshold = 1024;
+
+namespace
+{
+	/// Signed number for evaluation and interpolation in Toom-3.
+	/// Magnitude has no leading zero limbs, empty magnitude is zero.
+	struct SignedLimbs
+	{
+		std::vector<limb_t> mag;
+		bool isMinus = false;
+	};
+
+	/// Removes leading zero limbs.
+	void trim(std::vector<limb_t>& v)
+	{
+		while (!v.empty() && v.back() == 0)
+			v.pop_back();
+	}
+
+	/// Makes nonnegative signed number from array of limbs.
+	SignedLimbs fromLimbs(const limb_t* a, size_t n)
+	{
+		SignedLimbs res;
+		res.mag.assign(a, a + n);
+		trim(res.mag);
+		return res;
+	}
+
+	/// Compares magnitudes without leading zeros.
+	int cmpMag(const std::vector<limb_t>& a, const std::vector<limb_t>& b)
+	{
+		if (a.size() != b.size())
+			return a.size() < b.size() ? -1 : 1;
+
+		return limbs::cmp(a.data(), b.data(), a.size());
+	}
+
+	/// Computes a + b (or a - b if negate is true) for signed numbers.
+	SignedLimbs addSigned(const SignedLimbs& a, const SignedLimbs& b, bool negate = false)
+	{
+		bool bMinus = b.isMinus != negate;
+		SignedLimbs res;
+
+		if (a.isMinus == bMinus)
+		{
+			const SignedLimbs& x = a.mag.size() >= b.mag.size() ? a : b;
+			const SignedLimbs& y = a.mag.size() >= b.mag.size() ? b : a;
+
+			res.mag.resize(x.mag.size() + 1);
+			res.mag.back() = limbs::add(res.mag.data(), x.mag.data(), x.mag.size(), y.mag.data(), y.mag.size());
+			res.isMinus = a.isMinus;
+		}
+		else
+		{
+			bool aIsLess = cmpMag(a.mag, b.mag) < 0;
+			const std::vector<limb_t>& x = aIsLess ? b.mag : a.mag;
+			const std::vector<limb_t>& y = aIsLess ? a.mag : b.mag;
+
+			res.mag.resize(x.size());
+			limbs::sub(res.mag.data(), x.data(), x.size(), y.data(), y.size());
+			res.isMinus = aIsLess ? bMinus : a.isMinus;
+		}
+
+		trim(res.mag);
+		if (res.mag.empty())
+			res.isMinus = false;
+
+		return res;
+	}
+
+	/// Multiplies magnitude by small number in place.
+	void mulSmall(SignedLimbs& a, limb_t k)
+	{
+		a.mag.push_back(0);
+		a.mag.back() = limbs::mul1(a.mag.data(), a.mag.data(), a.mag.size() - 1, k);
+		trim(a.mag);
+	}
+
+	/// Divides magnitude by small number in place, division must be exact.
+	void divExactSmall(SignedLimbs& a, limb_t k)
+	{
+		limbs::divRem1(a.mag.data(), a.mag.data(), a.mag.size(), k);
+		trim(a.mag);
+		if (a.mag.empty())
+			a.isMinus = false;
+	}
+
+	/// Multiplies signed numbers of any length.
+	SignedLimbs mulSigned(const SignedLimbs& a, const SignedLimbs& b)
+	{
+		SignedLimbs res;
+		if (a.mag.empty() || b.mag.empty())
+			return res;
+
+		const std::vector<limb_t>& x = a.mag.size() >= b.mag.size() ? a.mag : b.mag;
+		const std::vector<limb_t>& y = a.mag.size() >= b.mag.size() ? b.mag : a.mag;
+
+		res.mag.resize(x.size() + y.size());
+		limbs::mul(res.mag.data(), x.data(), x.size(), y.data(), y.size());
+		res.isMinus = a.isMinus != b.isMinus;
+		trim(res.mag);
+
+		return res;
+	}
+
+	/// Squares signed number of any length.
+	SignedLimbs sqrSigned(const SignedLimbs& a)
+	{
+		SignedLimbs res;
+		if (a.mag.empty())
+			return res;
+
+		res.mag.resize(2 * a.mag.size());
+		limbs::sqr(res.mag.data(), a.mag.data(), a.mag.size());
+		trim(res.mag);
+
+		return res;
+	}
+
+	/// Runs independent products of recursive multiplication,
+	/// on the thread pool if operands are long enough.
+	/// Shorter operands call jobs directly without any allocation.
+	/// @param n count of limbs of the shorter operand.
+	/// @param products jobs, which write to disjoint memory.
+	template<typename... Jobs>
+	void runProducts(size_t n, Jobs&&... products)
+	{
+		if (n >= limbs::parallelThreshold)
+			ThreadPool::getInstance().runAll({ std::function<void()>(products)... });
+		else
+			(products(), ...);
+	}
+
+	/// Computes values of polynomial a2 * x^2 + a1 * x + a0 in points 1, -1 and -2.
+	void toom3Evaluate(const SignedLimbs& a0, const SignedLimbs& a1, const SignedLimbs& a2,
+		SignedLimbs& p1, SignedLimbs& pm1, SignedLimbs& pm2)
+	{
+		SignedLimbs t = addSigned(a0, a2);
+		p1 = addSigned(t, a1);
+		pm1 = addSigned(t, a1, true);
+		pm2 = addSigned(pm1, a2);
+		mulSmall(pm2, 2);
+		pm2 = addSigned(pm2, a0, true);
+	}
+
+	/// Interpolates product from values in 0, 1, -1, -2 and infinity
+	/// (Bodrato's sequence) and writes it to r with rn limbs.
+	/// @param k length of pieces of operands.
+	void toom3Interpolate(limb_t* r, size_t rn, size_t k, SignedLimbs& w0, SignedLimbs& w1,
+		SignedLimbs& wm1, SignedLimbs& wm2, SignedLimbs& winf)
+	{
+		SignedLimbs r3 = addSigned(wm2, w1, true);
+		divExactSmall(r3, 3);
+		SignedLimbs r1 = addSigned(w1, wm1, true);
+		divExactSmall(r1, 2);
+		SignedLimbs r2 = addSigned(wm1, w0, true);
+		r3 = addSigned(r2, r3, true);
+		divExactSmall(r3, 2);
+		SignedLimbs tmp = winf;
+		mulSmall(tmp, 2);
+		r3 = addSigned(r3, tmp);
+		r2 = addSigned(addSigned(r2, r1), winf, true);
+		r1 = addSigned(r1, r3, true);
+
+		// recomposition, all coefficients are nonnegative here
+		std::fill(r, r + rn, 0);
+
+		const SignedLimbs* coefs[] = { &w0, &r1, &r2, &r3, &winf };
+		for (size_t i = 0; i < 5; i++)
+		{
+			const std::vector<limb_t>& c = coefs[i]->mag;
+			if (!c.empty())
+				limbs::add(r + i * k, r + i * k, rn - i * k, c.data(), c.size());
+		}
+	}
+}
+
+void limbs::mulBasecase(limb_t* r, const limb_t* a, size_t an, const limb_t* b, size_t bn)
+{
+	r[an] = mul1(r, a, an, b[0]);
+
+	for (size_t i = 1; i < bn; i++)
+		r[an + i] = addMul1(r + i, a, an, b[i]);
+}
+
+void limbs::mulKaratsuba(limb_t* r, const limb_t* a, size_t an, const limb_t* b, size_t bn)
+{
+	// a = a1 * B^h + a0, b = b1 * B^h + b0
+	size_t h = (an + 1) / 2;
+	size_t a1n = an - h, b1n = bn - h;
+
+	std::vector<limb_t> tmp(4 * h + 4);
+	limb_t* sa = tmp.data();
+	limb_t* sb = sa + h + 1;
+	limb_t* z1 = sb + h + 1;
+
+	sa[h] = add(sa, a, h, a + h, a1n);
+	sb[h] = add(sb, b, h, b + h, b1n);
+
+	// z0 = a0 * b0 to low half, z2 = a1 * b1 to high half,
+	// (a0 + a1) * (b0 + b1) to z1, products write to disjoint memory
+	runProducts(bn,
+		[&]() { mul(r, a, h, b, h); },
+		[&]() { mul(r + 2 * h, a + h, a1n, b + h, b1n); },
+		[&]() { mul(z1, sa, h + 1, sb, h + 1); });
+
+	// z1 = (a0 + a1) * (b0 + b1) - z0 - z2
+	sub(z1, z1, 2 * h + 2, r, 2 * h);
+	sub(z1, z1, 2 * h + 2, r + 2 * h, a1n + b1n);
+
+	size_t z1n = 2 * h + 2;
+	while (z1n > 0 && z1[z1n - 1] == 0)
+		z1n--;
+
+	add(r + h, r + h, an + bn - h, z1, z1n);
+}
+
+void limbs::mulToom3(limb_t* r, const limb_t* a, size_t an, const limb_t* b, size_t bn)
+{
+	// a = a2 * B^2k + a1 * B^k + a0, the same for b
+	size_t k = (an + 2) / 3;
+
+	SignedLimbs a0 = fromLimbs(a, k), a1 = fromLimbs(a + k, k), a2 = fromLimbs(a + 2 * k, an - 2 * k);
+	SignedLimbs b0 = fromLimbs(b, k), b1 = fromLimbs(b + k, k), b2 = fromLimbs(b + 2 * k, bn - 2 * k);
+
+	SignedLimbs ap1, apm1, apm2, bp1, bpm1, bpm2;
+	toom3Evaluate(a0, a1, a2, ap1, apm1, apm2);
+	toom3Evaluate(b0, b1, b2, bp1, bpm1, bpm2);
+
+	// pointwise products in 0, 1, -1, -2 and infinity
+	SignedLimbs w0, w1, wm1, wm2, winf;
+	runProducts(bn,
+		[&]() { w0 = mulSigned(a0, b0); },
+		[&]() { w1 = mulSigned(ap1, bp1); },
+		[&]() { wm1 = mulSigned(apm1, bpm1); },
+		[&]() { wm2 = mulSigned(apm2, bpm2); },
+		[&]() { winf = mulSigned(a2, b2); });
+
+	toom3Interpolate(r, an + bn, k, w0, w1, wm1, wm2, winf);
+}
+
+void limbs::sqrBasecase(limb_t* r, const limb_t* a, size_t n)
+{
+	if (n == 1)
+	{
+		r[0] = mulWide(a[0], a[0], r[1]);
+		return;
+	}
+
+	// products a[i] * a[j] for i < j, each is computed once
+	r[0] = 0;
+	r[n] = mul1(r + 1, a + 1, n - 1, a[0]);
+
+	for (size_t i = 1; i + 1 < n; i++)
+		r[n + i] = addMul1(r + 2 * i + 1, a + i + 1, n - i - 1, a[i]);
+
+	// doubled, then squares a[i]^2 are added
+	r[2 * n - 1] = shiftLeft(r + 1, r + 1, 2 * n - 2, 1);
+
+	limb_t carry = 0;
+	for (size_t i = 0; i < n; i++)
+	{
+		limb_t hi, lo = mulWide(a[i], a[i], hi);
+		r[2 * i] = addCarry(r[2 * i], lo, carry);
+		r[2 * i + 1] = addCarry(r[2 * i + 1], hi, carry);
+	}
+}
+
+void limbs::sqrKaratsuba(limb_t* r, const limb_t* a, size_t n)
+{
+	// a = a1 * B^h + a0
+	size_t h = (n + 1) / 2;
+	size_t a1n = n - h;
+
+	// z1 = 2 * a0 * a1 = z0 + z2 - (a0 - a1)^2
+	std::vector<limb_t> tmp(3 * h + 1);
+	limb_t* d = tmp.data();
+	limb_t* z1 = d + h;
+
+	std::fill(d, d + h, 0);
+	std::copy(a + h, a + n, d);
+	if (cmp(a, d, h) >= 0)
+		subN(d, a, d, h);
+	else
+		subN(d, d, a, h);
+
+	size_t dn = h;
+	while (dn > 0 && d[dn - 1] == 0)
+		dn--;
+
+	// z0 = a0^2 to low half, z2 = a1^2 to high half
+	std::vector<limb_t> d2(2 * dn);
+	runProducts(n,
+		[&]() { sqr(r, a, h); },
+		[&]() { sqr(r + 2 * h, a + h, a1n); },
+		[&]() { if (dn > 0) sqr(d2.data(), d, dn); });
+
+	std::copy(r, r + 2 * h, z1);
+	z1[2 * h] = add(z1, z1, 2 * h, r + 2 * h, 2 * a1n);
+
+	if (dn > 0)
+		sub(z1, z1, 2 * h + 1, d2.data(), 2 * dn);
+
+	size_t z1n = 2 * h + 1;
+	while (z1n > 0 && z1[z1n - 1] == 0)
+		z1n--;
+
+	add(r + h, r + h, 2 * n - h, z1, z1n);
+}
+
+void limbs::sqrToom3(limb_t* r, const limb_t* a, size_t n)
+{
+	size_t k = (n + 2) / 3;
+
+	SignedLimbs a0 = fromLimbs(a, k), a1 = fromLimbs(a + k, k), a2 = fromLimbs(a + 2 * k, n - 2 * k);
+
+	SignedLimbs ap1, apm1, apm2;
+	toom3Evaluate(a0, a1, a2, ap1, apm1, apm2);
+
+	SignedLimbs w0, w1, wm1, wm2, winf;
+	runProducts(n,
+		[&]() { w0 = sqrSigned(a0); },
+		[&]() { w1 = sqrSigned(ap1); },
+		[&]() { wm1 = sqrSigned(apm1); },
+		[&]() { wm2 = sqrSigned(apm2); },
+		[&]() { winf = sqrSigned(a2); });
+
+	toom3Interpolate(r, 2 * n, k, w0, w1, wm1, wm2, winf);
+}
+
+void limbs::sqr(limb_t* r, const limb_t* a, size_t n)
+{
+	if (n < karatsubaThreshold || n < 4)
+		sqrBasecase(r, a, n);
+	else if (n >= nttThreshold && nttFits(n, n))
+		sqrNTT(r, a, n);
+	else if (n >= toom3Threshold)
+		sqrToom3(r, a, n);
+	else
+		sqrKaratsuba(r, a, n);
+}
+
+void limbs::mul(limb_t* r, const limb_t* a, size_t an, const limb_t* b, size_t bn)
+{
+	if (a == b && an == bn)
+	{
+		sqr(r, a, an);
+		return;
+	}
+
+	// Recursive algorithms need at least 4 limbs to make pieces shorter than operands.
+	if (bn < karatsubaThreshold || bn < 4)
+	{
+		mulBasecase(r, a, an, b, bn);
+		return;
+	}
+
+	if (bn >= nttThreshold && nttFits(an, bn))
+	{
+		mulNTT(r, a, an, b, bn);
+		return;
+	}
+
+	if (2 * bn <= an + 1)
+	{
+		// Unbalanced operands: multiply b by pieces of a with length bn.
+		std::vector<limb_t> tmp(2 * bn);
+
+		mul(r, a, bn, b, bn);
+		for (size_t done = bn; done < an; done += bn)
+		{
+			size_t cn = std::min(bn, an - done);
+
+			if (cn == bn)
+				mul(tmp.data(), a + done, cn, b, bn);
+			else
+				mul(tmp.data(), b, bn, a + done, cn);
+
+			std::fill(r + done + bn, r + done + bn + cn, 0);
+			add(r + done, r + done, bn + cn, tmp.data(), bn + cn);
+		}
+
+		return;
+	}
+
+	if (bn >= toom3Threshold && bn > 2 * ((an + 2) / 3))
+		mulToom3(r, a, an, b, bn);
+	else
+		mulKaratsuba(r, a, an, b, bn);
+}
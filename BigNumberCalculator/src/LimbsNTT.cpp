@@ -0,0 +1,292 @@
+#include "../hdrs/Limbs.h"
+#include "../hdrs/ThreadPool.h"
+
+#include <vector>
+#include <algorithm>
+#include <memory>
+#include <mutex>
+
+// one 64-bit limb gives two transform pieces, so NTT pays off later
+size_t limbs::nttThreshold = LIMB_BITS == 64 ? 4096 : 2048;
+
+namespace
+{
+	/// Count of 32-bit pieces, which one limb is split to for transform.
+	constexpr unsigned PIECES = LIMB_BITS / 32;
+
+	/// Primes p = c * 2^k + 1 for number-theoretic transform, 3 is primitive root of each.
+	constexpr uint32_t P1 = 998244353;  // 119 * 2^23 + 1
+	constexpr uint32_t P2 = 167772161;  // 5 * 2^25 + 1
+	constexpr uint32_t P3 = 469762049;  // 7 * 2^26 + 1
+
+	/// Maximal transform length, which all three primes support.
+	constexpr size_t MAX_LENGTH = (size_t)1 << 23;
+
+	/// Computes (base ^ exp) mod P.
+	template<uint32_t P>
+	uint32_t powModPrime(uint32_t base, uint64_t exp)
+	{
+		uint64_t res = 1, b = base;
+		for (; exp; exp >>= 1)
+		{
+			if (exp & 1)
+				res = res * b % P;
+			b = b * b % P;
+		}
+		return (uint32_t)res;
+	}
+
+	/// Computes x * w mod P by Shoup's method.
+	/// @param x any 32-bit number.
+	/// @param w multiplier less than P.
+	/// @param wShoup precomputed floor(w * 2^32 / P).
+	/// @return product modulo P.
+	template<uint32_t P>
+	inline uint32_t mulShoup(uint32_t x, uint32_t w, uint32_t wShoup)
+	{
+		uint32_t q = (uint32_t)(((uint64_t)x * wShoup) >> 32);
+		uint32_t r = x * w - q * P;
+		return r >= P ? r - P : r;
+	}
+
+	/// Powers of primitive roots for all levels of transform.
+	/// Level with block length len keeps len / 2 roots starting from index len / 2.
+	template<uint32_t P>
+	struct RootTable
+	{
+		std::vector<uint32_t> w, wShoup;
+
+		RootTable() {}
+
+		RootTable(size_t n, bool invert)
+			:
+			w(n), wShoup(n)
+		{
+			for (size_t half = 1; half < n; half <<= 1)
+			{
+				uint32_t root = powModPrime<P>(3, (P - 1) / (2 * half));
+				if (invert)
+					root = powModPrime<P>(root, P - 2);
+
+				uint64_t cur = 1;
+				for (size_t j = 0; j < half; j++)
+				{
+					w[half + j] = (uint32_t)cur;
+					wShoup[half + j] = (uint32_t)((cur << 32) / P);
+					cur = cur * root % P;
+				}
+			}
+		}
+	};
+
+	/// Gives table of roots for transforms up to length n.
+	/// Tables are computed once and grow with the longest transform.
+	/// Grown table replaces the old one, which lives while some thread uses it.
+	template<uint32_t P>
+	std::shared_ptr<const RootTable<P>> rootTable(size_t n, bool invert)
+	{
+		static std::shared_ptr<const RootTable<P>> tables[2];
+		static std::mutex mtx;
+
+		std::lock_guard<std::mutex> lock(mtx);
+
+		auto& table = tables[invert ? 1 : 0];
+		if (!table || table->w.size() < n)
+			table = std::make_shared<const RootTable<P>>(n, invert);
+
+		return table;
+	}
+
+	/// Forward transform modulo P (decimation in frequency).
+	/// Length is power of two, result is in bit-reversed order.
+	template<uint32_t P>
+	void nttForward(std::vector<uint32_t>& a, const RootTable<P>& roots)
+	{
+		size_t n = a.size();
+
+		for (size_t half = n / 2; half >= 1; half >>= 1)
+		{
+			const uint32_t* w = roots.w.data() + half;
+			const uint32_t* ws = roots.wShoup.data() + half;
+
+			for (size_t i = 0; i < n; i += 2 * half)
+			{
+				uint32_t* lo = a.data() + i;
+				uint32_t* hi = lo + half;
+
+				for (size_t j = 0; j < half; j++)
+				{
+					uint32_t u = lo[j], v = hi[j];
+
+					lo[j] = u + v >= P ? u + v - P : u + v;
+					hi[j] = mulShoup<P>(u + P - v, w[j], ws[j]);
+				}
+			}
+		}
+	}
+
+	/// Inverse transform modulo P (decimation in time).
+	/// Takes data in bit-reversed order, result is in natural order and divided by length.
+	template<uint32_t P>
+	void nttInverse(std::vector<uint32_t>& a, const RootTable<P>& roots)
+	{
+		size_t n = a.size();
+
+		for (size_t half = 1; half < n; half <<= 1)
+		{
+			const uint32_t* w = roots.w.data() + half;
+			const uint32_t* ws = roots.wShoup.data() + half;
+
+			for (size_t i = 0; i < n; i += 2 * half)
+			{
+				uint32_t* lo = a.data() + i;
+				uint32_t* hi = lo + half;
+
+				for (size_t j = 0; j < half; j++)
+				{
+					uint32_t u = lo[j];
+					uint32_t v = mulShoup<P>(hi[j], w[j], ws[j]);
+
+					lo[j] = u + v >= P ? u + v - P : u + v;
+					hi[j] = u >= v ? u - v : u + P - v;
+				}
+			}
+		}
+
+		uint32_t nInv = powModPrime<P>((uint32_t)(n % P), P - 2);
+		uint32_t nInvShoup = (uint32_t)(((uint64_t)nInv << 32) / P);
+		for (auto& x : a)
+			x = mulShoup<P>(x, nInv, nInvShoup);
+	}
+
+	/// Splits array of limbs to 32-bit pieces reduced modulo P.
+	template<uint32_t P>
+	void toPieces(std::vector<uint32_t>& res, const limb_t* a, size_t n)
+	{
+		for (size_t i = 0; i < n; i++)
+			for (unsigned k = 0; k < PIECES; k++)
+				res[i * PIECES + k] = (uint32_t)(a[i] >> (32 * k)) % P;
+	}
+
+	/// Runs jobs on the thread pool for long operands, otherwise one by one.
+	/// @param n count of limbs of the shorter operand.
+	/// @param jobs independent jobs.
+	void runJobs(size_t n, const std::vector<std::function<void()>>& jobs)
+	{
+		if (n >= limbs::parallelThreshold)
+			ThreadPool::getInstance().runAll(jobs);
+		else
+			for (auto& job : jobs)
+				job();
+	}
+
+	/// Computes cyclic convolution of a and b modulo P with given transform length.
+	/// The same array for a and b is transformed only once,
+	/// forward transforms of different arrays run in parallel for long operands.
+	template<uint32_t P>
+	std::vector<uint32_t> convolution(const limb_t* a, size_t an, const limb_t* b, size_t bn, size_t len)
+	{
+		std::vector<uint32_t> fa(len, 0);
+		auto forward = rootTable<P>(len, false);
+
+		if (a == b && an == bn)
+		{
+			toPieces<P>(fa, a, an);
+			nttForward<P>(fa, *forward);
+
+			for (size_t i = 0; i < len; i++)
+				fa[i] = (uint32_t)((uint64_t)fa[i] * fa[i] % P);
+		}
+		else
+		{
+			std::vector<uint32_t> fb(len, 0);
+
+			runJobs(std::min(an, bn),
+			{
+				[&]() { toPieces<P>(fa, a, an); nttForward<P>(fa, *forward); },
+				[&]() { toPieces<P>(fb, b, bn); nttForward<P>(fb, *forward); }
+			});
+
+			for (size_t i = 0; i < len; i++)
+				fa[i] = (uint32_t)((uint64_t)fa[i] * fb[i] % P);
+		}
+
+		nttInverse<P>(fa, *rootTable<P>(len, true));
+
+		return fa;
+	}
+
+	/// Transform length for product of arrays with an and bn limbs.
+	size_t nttLength(size_t an, size_t bn)
+	{
+		size_t need = (an + bn) * PIECES, len = 1;
+		while (len < need)
+			len <<= 1;
+		return len;
+	}
+}
+
+bool limbs::nttFits(size_t an, size_t bn)
+{
+	return nttLength(an, bn) <= MAX_LENGTH;
+}
+
+void limbs::mulNTT(limb_t* r, const limb_t* a, size_t an, const limb_t* b, size_t bn)
+{
+	size_t len = nttLength(an, bn);
+
+	// convolutions modulo different primes are independent
+	std::vector<uint32_t> c1, c2, c3;
+	runJobs(bn,
+	{
+		[&]() { c1 = convolution<P1>(a, an, b, bn, len); },
+		[&]() { c2 = convolution<P2>(a, an, b, bn, len); },
+		[&]() { c3 = convolution<P3>(a, an, b, bn, len); }
+	});
+
+	// Garner's constants
+	const uint64_t p1InvMod2 = powModPrime<P2>(P1 % P2, P2 - 2);
+	const uint64_t p12InvMod3 = powModPrime<P3>((uint32_t)((uint64_t)P1 * P2 % P3), P3 - 2);
+	const uint64_t p12 = (uint64_t)P1 * P2;
+
+	// Each coefficient is less than 2^86, running carry is kept in two 64-bit words.
+	uint64_t carryLo = 0, carryHi = 0;
+	size_t rn = an + bn;
+	size_t pieces = rn * PIECES;
+
+	std::fill(r, r + rn, 0);
+
+	for (size_t i = 0; i < pieces; i++)
+	{
+		uint64_t v1 = c1[i];
+		uint64_t v2 = (c2[i] + P2 - v1 % P2) % P2 * p1InvMod2 % P2;
+		uint64_t low = v1 + P1 * v2;
+		uint64_t v3 = (c3[i] + P3 - low % P3) % P3 * p12InvMod3 % P3;
+
+		// x = low + p12 * v3
+		uint64_t tl = (p12 & 0xFFFFFFFF) * v3;
+		uint64_t th = (p12 >> 32) * v3;
+
+		uint64_t xLo = low + tl;
+		uint64_t xHi = th >> 32;
+		uint64_t add = th << 32;
+		xLo += add;
+		if (xLo < add)
+			xHi++;
+
+		carryLo += xLo;
+		if (carryLo < xLo)
+			carryHi++;
+		carryHi += xHi;
+
+		r[i / PIECES] |= (limb_t)(carryLo & 0xFFFFFFFF) << (32 * (i % PIECES));
+
+		carryLo = (carryLo >> 32) | (carryHi << 32);
+		carryHi >>= 32;
+	}
+}
+
+void limbs::sqrNTT(limb_t* r, const limb_t* a, size_t n)
+{
+	mulNTT(r, a, n, a, n);
+}
@@ -0,0 +1,270 @@
+#include "../hdrs/Limbs.h"
+#include "../hdrs/ThreadPool.h"
+
+#include <vector>
+#include <deque>
+#include <mutex>
+#include <algorithm>
+
+size_t limbs::radixThreshold = 40;
+
+namespace
+{
+	/// Unsigned number without leading zero limbs, empty array is zero.
+	typedef std::vector<limb_t> Number;
+
+	/// Count of decimal digits, which are put into one limb at once.
+	constexpr size_t CHUNK_DIGITS = 9;
+
+	/// 10 ^ CHUNK_DIGITS, fits into any limb.
+	constexpr limb_t CHUNK_BASE = 1000000000;
+
+	/// Removes leading zero limbs.
+	void trim(Number& x)
+	{
+		while (!x.empty() && x.back() == 0)
+			x.pop_back();
+	}
+
+	/// Computes a * b.
+	Number mulNum(const Number& a, const Number& b)
+	{
+		if (a.empty() || b.empty())
+			return Number();
+
+		const Number& x = a.size() >= b.size() ? a : b;
+		const Number& y = a.size() >= b.size() ? b : a;
+
+		Number res(x.size() + y.size());
+		limbs::mul(res.data(), x.data(), x.size(), y.data(), y.size());
+		trim(res);
+		return res;
+	}
+
+	/// Gives 10 ^ (CHUNK_DIGITS * 2^k).
+	/// Powers are computed by squaring once and kept for next calls.
+	/// Deque doesn't move kept powers, when it grows in another thread.
+	const Number& chunkPower(size_t k)
+	{
+		static std::deque<Number> powers(1, Number(1, CHUNK_BASE));
+		static std::mutex mtx;
+
+		std::lock_guard<std::mutex> lock(mtx);
+
+		while (powers.size() <= k)
+			powers.push_back(mulNum(powers.back(), powers.back()));
+
+		return powers[k];
+	}
+
+	/// Runs two halves of conversion, on the thread pool if the number is long enough.
+	/// @param n count of limbs of the number.
+	template<typename High, typename Low>
+	void runHalves(size_t n, High&& high, Low&& low)
+	{
+		if (n >= limbs::parallelThreshold)
+			ThreadPool::getInstance().runAll({ std::function<void()>(high), std::function<void()>(low) });
+		else
+		{
+			high();
+			low();
+		}
+	}
+
+	/// Reads up to CHUNK_DIGITS decimal digits.
+	limb_t readChunk(const char* s, size_t len)
+	{
+		limb_t res = 0;
+		for (size_t i = 0; i < len; i++)
+			res = res * 10 + (limb_t)(s[i] - '0');
+
+		return res;
+	}
+
+	/// Converts digits to limbs by multiplying accumulated value
+	/// by 10^9 and adding the next nine digits, O(len^2).
+	/// @param[out] r result, enough space for the number.
+	/// @return count of significant limbs.
+	size_t fromDecimalBasecase(limb_t* r, const char* s, size_t len)
+	{
+		size_t n = 0;
+
+		// the first chunk is shorter, so that others have exactly CHUNK_DIGITS digits
+		size_t first = len % CHUNK_DIGITS ? len % CHUNK_DIGITS : CHUNK_DIGITS;
+
+		for (size_t pos = 0; pos < len; pos += first, first = CHUNK_DIGITS)
+		{
+			limb_t carry = readChunk(s + pos, first);
+
+			for (size_t i = 0; i < n; i++)
+				r[i] = limbs::mulAddCarry(r[i], CHUNK_BASE, 0, carry);
+
+			if (carry)
+				r[n++] = carry;
+		}
+
+		return n;
+	}
+
+	/// Converts digits to limbs by splitting string to high and low parts,
+	/// where low part has CHUNK_DIGITS * 2^k digits:
+	/// value = high * 10^(CHUNK_DIGITS * 2^k) + low.
+	Number fromDecimalDC(const char* s, size_t len)
+	{
+		Number res;
+
+		if (len <= CHUNK_DIGITS * limbs::radixThreshold)
+		{
+			res.resize(limbs::decimalLimbs(len));
+			res.resize(fromDecimalBasecase(res.data(), s, len));
+			return res;
+		}
+
+		size_t k = 0;
+		while (CHUNK_DIGITS << (k + 1) < len)
+			k++;
+
+		size_t lowLen = CHUNK_DIGITS << k;
+		const Number& power = chunkPower(k);
+
+		Number low;
+		runHalves(power.size(),
+			[&]() { res = mulNum(fromDecimalDC(s, len - lowLen), power); },
+			[&]() { low = fromDecimalDC(s + len - lowLen, lowLen); });
+
+		res.resize(std::max(res.size(), low.size()) + 1, 0);
+		limbs::add(res.data(), res.data(), res.size(), low.data(), low.size());
+		trim(res);
+
+		return res;
+	}
+
+	/// Computes quotient and reminder of a / d.
+	void divNum(const Number& a, const Number& d, Number& q, Number& r)
+	{
+		if (a.size() < d.size() || (a.size() == d.size() && limbs::cmp(a.data(), d.data(), a.size()) < 0))
+		{
+			q.clear();
+			r = a;
+			return;
+		}
+
+		q.assign(a.size() - d.size() + 1, 0);
+		r.assign(d.size(), 0);
+
+		if (d.size() == 1)
+			r[0] = limbs::divRem1(q.data(), a.data(), a.size(), d[0]);
+		else
+			limbs::divRem(q.data(), r.data(), a.data(), a.size(), d.data(), d.size());
+
+		trim(q);
+		trim(r);
+	}
+
+	/// Writes CHUNK_DIGITS digits of chunk with leading zeros.
+	void writeChunk(char* s, limb_t chunk)
+	{
+		for (size_t i = CHUNK_DIGITS; i-- > 0; chunk /= 10)
+			s[i] = (char)('0' + chunk % 10);
+	}
+
+	/// Splits number into chunks of CHUNK_DIGITS digits
+	/// by repeated division by 10^9, O(n^2).
+	/// @return chunks, the least significant goes first.
+	std::vector<limb_t> toChunks(Number a)
+	{
+		std::vector<limb_t> chunks;
+
+		while (!a.empty())
+		{
+			chunks.push_back(limbs::divRem1(a.data(), a.data(), a.size(), CHUNK_BASE));
+			trim(a);
+		}
+
+		return chunks;
+	}
+
+	/// Writes exactly len digits of a < 10^len, including leading zeros.
+	/// Number is split by 10^(CHUNK_DIGITS * 2^k) into high and low parts,
+	/// which are written recursively.
+	void toDecimalPadded(char* s, size_t len, const Number& a)
+	{
+		if (a.size() <= limbs::radixThreshold)
+		{
+			std::fill(s, s + len, '0');
+
+			char* end = s + len;
+			for (limb_t chunk : toChunks(a))
+			{
+				char buf[CHUNK_DIGITS];
+				writeChunk(buf, chunk);
+
+				size_t cnt = std::min<size_t>(CHUNK_DIGITS, end - s);
+				std::copy(buf + CHUNK_DIGITS - cnt, buf + CHUNK_DIGITS, end - cnt);
+				end -= cnt;
+			}
+
+			return;
+		}
+
+		size_t k = 0;
+		while (CHUNK_DIGITS << (k + 1) < len)
+			k++;
+
+		size_t lowLen = CHUNK_DIGITS << k;
+		Number q, r;
+		divNum(a, chunkPower(k), q, r);
+
+		// halves are written to disjoint parts of the string
+		runHalves(a.size(),
+			[&]() { toDecimalPadded(s, len - lowLen, q); },
+			[&]() { toDecimalPadded(s + len - lowLen, lowLen, r); });
+	}
+}
+
+size_t limbs::decimalLimbs(size_t len)
+{
+	// log2(10) < 3.33, one extra limb covers rounding
+	return len * 333 / 100 / LIMB_BITS + 2;
+}
+
+size_t limbs::fromDecimal(limb_t* r, const char* s, size_t len)
+{
+	if (len <= CHUNK_DIGITS * radixThreshold)
+		return fromDecimalBasecase(r, s, len);
+
+	Number res = fromDecimalDC(s, len);
+	std::copy(res.begin(), res.end(), r);
+
+	return res.size();
+}
+
+size_t limbs::decimalDigits(size_t n)
+{
+	// log10(2) < 0.30103
+	return n * LIMB_BITS * 30103 / 100000 + 1;
+}
+
+size_t limbs::toDecimal(char* s, const limb_t* a, size_t n)
+{
+	while (n > 0 && a[n - 1] == 0)
+		n--;
+
+	if (n == 0)
+	{
+		s[0] = '0';
+		return 1;
+	}
+
+	// all digits are written with leading zeros to the given space,
+	// so subtrees of conversion don't depend on lengths of each other
+	size_t len = decimalDigits(n);
+	toDecimalPadded(s, len, Number(a, a + n));
+
+	size_t zeros = 0;
+	while (s[zeros] == '0')
+		zeros++;
+
+	std::copy(s + zeros, s + len, s);
+	return len - zeros;
+}
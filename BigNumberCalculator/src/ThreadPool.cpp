@@ -0,0 +1,131 @@
+#include "../hdrs/ThreadPool.h"
+
+#include <exception>
+#include <algorithm>
+
+ThreadPool::ThreadPool()
+{
+	setThreads(0);
+}
+
+ThreadPool::~ThreadPool()
+{
+	stop();
+}
+
+ThreadPool& ThreadPool::getInstance()
+{
+	static ThreadPool pool;
+	return pool;
+}
+
+void ThreadPool::start(size_t n)
+{
+	stopping = false;
+	for (size_t i = 1; i < n; i++)
+		workers.emplace_back(&ThreadPool::workerLoop, this);
+}
+
+void ThreadPool::stop()
+{
+	{
+		std::lock_guard<std::mutex> lock(mtx);
+		stopping = true;
+	}
+	changed.notify_all();
+
+	for (auto& worker : workers)
+		worker.join();
+	workers.clear();
+}
+
+void ThreadPool::workerLoop()
+{
+	std::unique_lock<std::mutex> lock(mtx);
+
+	while (true)
+	{
+		changed.wait(lock, [this]() { return stopping || !tasks.empty(); });
+		if (tasks.empty())
+			return;
+
+		std::function<void()> task = std::move(tasks.front());
+		tasks.pop_front();
+
+		lock.unlock();
+		task();
+		lock.lock();
+	}
+}
+
+void ThreadPool::setThreads(size_t n)
+{
+	if (n == 0)
+		n = std::max(std::thread::hardware_concurrency(), 1u);
+
+	stop();
+	start(n);
+}
+
+void ThreadPool::runAll(const std::vector<std::function<void()>>& jobs)
+{
+	if (workers.empty() || jobs.size() < 2)
+	{
+		for (auto& job : jobs)
+			job();
+		return;
+	}
+
+	size_t left = jobs.size();
+	std::exception_ptr error;
+
+	// wrapped jobs never throw, exception goes to the calling thread
+	auto run = [&](const std::function<void()>& job)
+	{
+		std::exception_ptr caught;
+		try
+		{
+			job();
+		}
+		catch (...)
+		{
+			caught = std::current_exception();
+		}
+
+		std::lock_guard<std::mutex> lock(mtx);
+		if (caught && !error)
+			error = caught;
+		left--;
+		changed.notify_all();
+	};
+
+	{
+		std::lock_guard<std::mutex> lock(mtx);
+		for (size_t i = 1; i < jobs.size(); i++)
+			tasks.push_back([&run, &jobs, i]() { run(jobs[i]); });
+	}
+	changed.notify_all();
+
+	run(jobs[0]);
+
+	// helps with queued jobs, possibly of other groups, until own ones are finished
+	std::unique_lock<std::mutex> lock(mtx);
+	while (left > 0)
+	{
+		if (tasks.empty())
+		{
+			changed.wait(lock);
+			continue;
+		}
+
+		std::function<void()> task = std::move(tasks.front());
+		tasks.pop_front();
+
+		lock.unlock();
+		task();
+		lock.lock();
+	}
+
+	if (error)
+		std::rethrow_exception(error);
+}